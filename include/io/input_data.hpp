@@ -14,6 +14,25 @@ namespace InputData {
     int get_number_of_machines();
     std::vector<int> get_processing_times(int number_of_jobs);
     
+    // Speed factor of each machine in machine order, 1.0 = reference generation
+    std::vector<double> get_machine_speeds(int number_of_machines);
+    
+    // Transfer cost between job i and i + 1 when they run on different machines
+    std::vector<int> get_communication_costs(int number_of_jobs);
+    
+    // Cores per node when the machines are grouped into nodes: 8, 4, 2 or 1,
+    // whichever divides number_of_machines first
+    int get_cores_per_node(int number_of_machines);
+    
+    // Machine that drops out in the machine-loss scenario, in machine order
+    int get_lost_machine(int number_of_machines);
+    
+    // Memory bandwidth used by each job, a second resource next to its time
+    std::vector<int> get_memory_bandwidth(int number_of_jobs);
+    
+    // Per-machine capacity of each resource, in the order time, memory bandwidth
+    std::vector<long long> get_resource_capacities();
+    
     
     // ============================================
     // MILP SOLVER PARAMETERS STRUCTURE
@@ -22,11 +41,41 @@ namespace InputData {
     struct MILPParameters {
         double time_limit; 
         double mip_gap;         
+        bool skip_if_certified;  // Skip the MILP when the pseudo-polynomial certificate verifies
         
         void print() const;
     };
     
     MILPParameters get_milp_parameters();
+    
+    
+    // ============================================
+    // CAPACITY PLANNING PARAMETERS STRUCTURE
+    // ============================================
+    
+    struct CapacityParameters {
+        int max_machines;       // T*(k) is reported for k = 1..max_machines
+        int target_makespan;    // Target of the minimum-machines query
+        
+        void print() const;
+    };
+    
+    CapacityParameters get_capacity_parameters();
+    
+    
+    // ============================================
+    // COARSENING PARAMETERS STRUCTURE
+    // ============================================
+    
+    struct CoarseningParameters {
+        int group_size;         // Jobs (or super-jobs) merged per super-job at each level
+        int coarse_jobs;        // Coarsen while a level holds more super-jobs than this
+        int max_fine_probes;    // Probes on the fine chain after the coarse solve, -1 = until exact
+        
+        void print() const;
+    };
+    
+    CoarseningParameters get_coarsening_parameters();
 } 
 
 #endif
\ No newline at end of file
@@ -3,9 +3,12 @@
 
 #include <string>
 #include <vector>
-#include <map>
 #include "models/milp_solver.hpp"
 #include "models/pseudo_polynomial.hpp"
+#include "models/hierarchical_partition.hpp"
+#include "models/sensitivity.hpp"
+#include "models/stable_partition.hpp"
+#include "models/partition_verifier.hpp"
 
 namespace OutputWriterJson {
 
@@ -17,10 +20,11 @@ namespace OutputWriterJson {
         double makespan;
         double solution_time;
         std::string status;
-        double gap;                     // only for MILP
+        double gap;                     // MILP gap, or heuristic gap to the lower bound
         int feasibility_checks;         // only for pseudo-polynomial
-        std::map<int, std::vector<int>> assignments;
-        std::vector<int> machine_loads;
+        std::vector<int> split_points;  // Written as [start, end) job ranges
+        std::vector<long long> machine_loads;
+        std::vector<int> witness;       // Greedy ends proving makespan - 1 infeasible, if recorded
     };
 
     // ============================================
@@ -39,6 +43,14 @@ namespace OutputWriterJson {
         bool solutions_match;
         double makespan_difference;
         double speedup;
+        std::string validated_by;           // "milp", or "certificate" when the MILP was skipped
+        
+        CapacityProfile capacity_profile;   // Written only when the curve is filled
+        std::vector<AlgorithmResult> free_order_results;  // Written only when filled
+        HierarchicalSolution hierarchical;  // Written as nested node/core blocks when solved
+        SensitivityReport sensitivity;      // Written as flat arrays when analysed
+        CertificateCheck certificate;       // Written with the pseudo-polynomial witness
+        StableRepartition stable;           // Written when a re-optimization ran
     };
 
     class JsonWriter {
@@ -77,6 +89,16 @@ namespace OutputWriterJson {
             const MILPSolution& milp_solution
         );
         
+        /**
+         * @brief Attach the optimality certificate of the pseudo-polynomial solution
+         * @param result Test result to update
+         * @param certificate Result of PartitionVerifier::verify
+         *
+         * When the MILP was skipped because the certificate verified, the
+         * certificate confirms the makespan in place of the MILP comparison.
+         */
+        static void attachCertificate(TestResult& result, const CertificateCheck& certificate);
+        
         // ============================================
         // ALGORITHM RESULT CREATION METHODS (PUBLIC)
         // ============================================
@@ -103,6 +125,17 @@ namespace OutputWriterJson {
             const std::vector<int>& times
         );
         
+        /**
+         * @brief Create algorithm result from a free-order heuristic solution
+         * @param name Heuristic name, used as the JSON key
+         * @param solution Heuristic solution with its gap to the lower bound
+         * @return AlgorithmResult object
+         */
+        static AlgorithmResult createFreeOrderResult(
+            const std::string& name,
+            const PseudoPolySolution& solution
+        );
+        
         // ============================================
         // SIMPLIFIED OUTPUT METHODS
         // ============================================
@@ -171,6 +204,13 @@ namespace OutputWriterJson {
          * @return Escaped string
          */
         static std::string escapeJsonString(const std::string& str);
+        
+        /**
+         * @brief Format split points as a JSON array of [start, end) job ranges
+         * @param split_points Block boundaries, first 0 and last n
+         * @return JSON array string, "[]" when there are no blocks
+         */
+        static std::string blockRanges(const std::vector<int>& split_points);
     };
 
 } // namespace OutputWriterJson
@@ -0,0 +1,39 @@
+#ifndef CIRCULAR_PARTITION_HPP
+#define CIRCULAR_PARTITION_HPP
+
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+// Contiguous partitioning of a cyclic chain: job n - 1 is followed by job 0, so
+// any rotation is a valid start and the best one is found directly. split_points
+// are unrolled positions: the first is the starting job s in [0, n), the last is
+// s + n, and arc k holds jobs j mod n for j in [split_points[k], split_points[k + 1]).
+//
+// The unrotated linear optimum B is one rotation. If the ring does better, its
+// partition has makespan at most B - 1, and each greedy arc from job 0 at B - 1
+// that stopped before its next job exceeds B - 1 together with that job, so the
+// partition starts an arc inside that window. Only the starts of the shortest
+// window (about n / m of them) are tried, in one sweep: each start is tested at
+// the current B - 1 with m galloping jumps from the previous start's boundaries,
+// which only move forward, and a start that passes is solved exactly and lowers
+// B. The sweep costs O(n) jumps in total, about one more pass over the data.
+class CircularPartitionSolver {
+public:
+    CircularPartitionSolver() = default;
+
+    PseudoPolySolution solve(const std::vector<int>& times, int m, bool is_test_mode = false);
+
+private:
+    PseudoPolynomialSolver linear_solver_;   // Upper bound from the unrotated chain
+    std::vector<long long> prefix_;          // prefix_[i] = t_0 + ... + t_{i-1}
+    std::vector<int> boundaries_;            // Arc ends of the previous start in the sweep
+
+    long long unrolled(int position) const;
+    int reach(int position, long long T, int limit, int hint) const;
+    bool sweepStart(int start, long long T, int m);
+    long long solveRotation(int start, long long left, long long right, int m, int& checks) const;
+    void arcs(int start, long long T, std::vector<int>& split_points,
+              std::vector<long long>& loads) const;
+};
+
+#endif
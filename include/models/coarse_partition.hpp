@@ -0,0 +1,65 @@
+#ifndef COARSE_PARTITION_HPP
+#define COARSE_PARTITION_HPP
+
+#include <string>
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+struct CoarseningOptions {
+    int group_size = 64;           // Jobs (or super-jobs) merged into one super-job per level
+    int coarse_jobs = 65536;       // Coarsen while a level holds more super-jobs than this
+    int max_fine_probes = 8;       // Probes on the fine chain after the coarse solve, -1 = until exact
+};
+
+// Partition of a coarsened chain refined on the fine data, with its error bound
+struct CoarseSolution {
+    long long makespan = -1;                 // Largest block load of split_points on the fine chain
+    long long lower_bound = -1;              // Proven lower bound on the fine T*
+    long long error_bound = -1;              // makespan - lower_bound, at most max_super_job
+    std::vector<int> split_points;           // Fine job indices, at most m blocks
+    std::vector<long long> machine_loads;
+    int levels = 0;                          // Coarsening levels above the fine chain
+    int coarse_jobs = 0;                     // Super-jobs in the chain solved by the coarse solver
+    long long max_super_job = 0;             // Heaviest of those super-jobs
+    int coarse_checks = 0;                   // Probes of the coarse solve
+    int fine_checks = 0;                     // Probes over the fine data
+    double solve_time = 0.0;
+    std::string status;                      // "optimal" once the bound is 0, else "approximate"
+};
+
+// Approximate planning for very long chains. One pass merges every group_size
+// consecutive jobs into a super-job, and the super-jobs again, until a level
+// holds at most coarse_jobs of them (or coarsening further would leave m or
+// fewer, or overflow int). PseudoPolynomialSolver solves that top chain exactly
+// for T_c. Its blocks are valid on the fine chain, so T* <= T_c. Rounding each
+// fine boundary up to a super-job edge adds at most one partial super-job to a
+// block, so T_c <= T* + W, with W the heaviest top super-job.
+//
+// The window [T_c - W, T_c] is then narrowed by parametric probes on the fine
+// chain. A greedy jump climbs the levels to the top, binary searches the top
+// prefix sums and descends into the super-job that overflows, reading at most
+// group_size entries per level. A fine probe thus costs O(m (levels group_size
+// + log n)) instead of a pass over the data, and no fine prefix sums are
+// stored: memory is n / group_size sums. The reported error bound is the width
+// left after max_fine_probes probes, and 0 means the partition is optimal.
+class CoarsePartitionSolver {
+public:
+    explicit CoarsePartitionSolver(const CoarseningOptions& options = CoarseningOptions())
+        : options_(options) {}
+
+    CoarseSolution solve(const std::vector<int>& times, int m, bool is_test_mode = false);
+
+private:
+    CoarseningOptions options_;
+    PseudoPolynomialSolver coarse_solver_;
+    std::vector<std::vector<long long>> levels_;  // levels_[l][i]: load of super-job i at level l + 1
+    std::vector<int> top_times_;             // Super-jobs of the top level, for the coarse solve
+    std::vector<long long> top_prefix_;      // Prefix sums over top_times_
+
+    long long entry(const std::vector<int>& times, int level, long long index) const;
+    long long entries(const std::vector<int>& times, int level) const;
+    int jump(const std::vector<int>& times, int start, long long T, long long& load) const;
+    bool probe(const std::vector<int>& times, long long T, int m, long long& candidate) const;
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef DP_SOLVER_HPP
+#define DP_SOLVER_HPP
+
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+// Objective minimized by the DP engine over partitions into m contiguous blocks
+enum class PartitionObjective {
+    Makespan,      // Largest block load (same optimum as the greedy engines)
+    SumOfSquares   // Sum of squared block loads
+};
+
+// Exact dynamic program over the partitions of the first j jobs into k blocks.
+//
+//   D[k][j] = min over i of combine(D[k-1][i], P[j] - P[i])
+//
+// Both objectives have monotone optimal split points (opt(k, j) <= opt(k, j+1)),
+// so each layer is filled by divide and conquer in O(n log n) instead of O(n^2),
+// for O(m n log n) overall. It serves as an independent oracle for the greedy
+// engines and handles objectives the feasibility check cannot express.
+class DPSolver {
+public:
+    explicit DPSolver(PartitionObjective objective = PartitionObjective::Makespan)
+        : objective_(objective) {}
+    
+    PseudoPolySolution solve(const std::vector<int>& times, int m,
+                         bool is_test_mode = false);
+    
+private:
+    PartitionObjective objective_;
+    std::vector<long long> prefix_;          // prefix_[i] = t_0 + ... + t_{i-1}
+    std::vector<long long> previous_;        // D[k-1][.]
+    std::vector<long long> current_;         // D[k][.]
+    std::vector<std::vector<int>> split_;    // split_[k][j]: start of the last block
+    
+    long long combine(long long before, int i, int j) const;
+    void fillLayer(int k, int j_lo, int j_hi, int i_lo, int i_hi);
+};
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef DYNAMIC_INSTANCE_HPP
+#define DYNAMIC_INSTANCE_HPP
+
+#include <vector>
+#include <random>
+#include "models/pseudo_polynomial.hpp"
+
+// Job chain that can be edited in place and keeps its optimal partition current.
+//
+// The jobs live in an implicit treap (balanced by random priorities) whose nodes
+// carry subtree size, load and maximum time, so inserting, deleting or updating a
+// job costs O(log n) and one greedy block jump is a single O(log n) descent.
+// After every edit the optimal makespan is searched again, warm-started from the
+// previous T*: one job growing, shrinking, appearing or disappearing by d moves
+// T* by at most d in the same direction, so the search runs over
+// [T* - d, T* + d] cut to the standard bounds, O(m log n log d) overall.
+class DynamicInstance {
+public:
+    // Throws std::invalid_argument for m < 1 or a time < 1
+    DynamicInstance(const std::vector<int>& times, int m);
+    
+    // Edits; positions are 0-based job indices, out-of-range ones throw std::out_of_range
+    void insertJob(int position, int time);
+    void eraseJob(int position);
+    void updateJob(int position, int time);
+    
+    int size() const;
+    int machines() const { return m_; }
+    long long makespan() const { return makespan_; }
+    
+    // Greedy blocks for the current makespan: block k holds jobs
+    // [split_points[k], split_points[k + 1]), split_points.back() == size()
+    const std::vector<int>& splitPoints() const { return split_points_; }
+    
+    // Probes spent by the last re-solve
+    int lastFeasibilityChecks() const { return last_checks_; }
+    
+    // Materialized solution for the JSON writer and the test runner, O(n)
+    PseudoPolySolution toSolution() const;
+    
+private:
+    struct Node {
+        int time;
+        unsigned priority;
+        int left;
+        int right;
+        int size;          // Jobs in the subtree
+        long long sum;     // Load of the subtree
+        int max_time;      // Longest job in the subtree
+    };
+    
+    // Result of one descent: jobs whose prefix sum is <= a limit
+    struct Prefix {
+        int count;         // Number of such jobs
+        long long sum;     // Their total load
+        int next_time;     // Time of the first job past the limit, 0 if none
+    };
+    
+    std::vector<Node> nodes_;  // nodes_[0] is the empty sentinel
+    std::vector<int> free_nodes_;
+    int root_ = 0;
+    int m_;
+    std::mt19937 rng_;
+    
+    long long makespan_ = 0;
+    std::vector<int> split_points_;
+    int last_checks_ = 0;
+    
+    int newNode(int time);
+    void pull(int v);
+    void split(int v, int k, int& left, int& right);
+    int merge(int left, int right);
+    void assign(int v, int k, int time);
+    void collect(int v, std::vector<int>& times) const;
+    
+    Prefix prefixAtMost(long long limit) const;
+    bool probe(long long T, long long& candidate) const;
+    void resolve(long long lower, long long upper);
+};
+
+#endif
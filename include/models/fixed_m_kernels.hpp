@@ -0,0 +1,31 @@
+#ifndef FIXED_M_KERNELS_HPP
+#define FIXED_M_KERNELS_HPP
+
+#include <cstdint>
+
+// Block-jump kernels specialized at compile time for m <= kMaxMachines.
+// Each instantiation for a fixed M fully unrolls the block loop, keeps the greedy
+// state in locals and the block ends in a stack array, and never allocates. The
+// instantiations sit in a dispatch table indexed by m and are picked at runtime.
+namespace FixedMKernels {
+
+    constexpr int kMaxMachines = 16;
+    
+    // Same contract as PrefixPartition::probeCandidate on prefix[0..n]
+    template <typename AccT>
+    using ProbeFn = bool (*)(const AccT* prefix, int n, AccT T, AccT& candidate);
+    
+    // Greedy split points for a feasible T: writes 0 and the block ends to
+    // split_points (room for kMaxMachines + 1 entries) and returns their count
+    template <typename AccT>
+    using SplitFn = int (*)(const AccT* prefix, int n, AccT T, int* split_points);
+    
+    // Kernels for m machines; nullptr when m is outside [1, kMaxMachines]
+    template <typename AccT>
+    ProbeFn<AccT> probeFor(int m);
+    
+    template <typename AccT>
+    SplitFn<AccT> splitPointsFor(int m);
+}
+
+#endif
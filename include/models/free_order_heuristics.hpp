@@ -0,0 +1,62 @@
+#ifndef FREE_ORDER_HEURISTICS_HPP
+#define FREE_ORDER_HEURISTICS_HPP
+
+#include <string>
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+// Constructive heuristics for schedules where jobs may be reordered (P||Cmax)
+enum class FreeOrderHeuristic {
+    LPT,            // Longest processing time first onto the least loaded machine (heap)
+    Multifit,       // Bisection on a bin capacity with first fit decreasing into m bins
+    KarmarkarKarp   // m-way largest differencing over partial schedules
+};
+
+struct FreeOrderOptions {
+    bool polish = true;              // Run the local search after the construction
+    long long polish_moves = -1;     // Cap on improving moves, -1 = n
+    int multifit_iterations = 10;    // Capacity bisection steps (MULTIFIT is within 1.22 + 2^-k)
+};
+
+// Fast schedules with a quality bound, written as a PseudoPolySolution over a
+// job order: block k holds jobs job_order[split_points[k] .. split_points[k + 1]).
+//
+// After sorting once (counting sort for short times), LPT runs in O(n log m) and
+// MULTIFIT in O(k n log m) with a max segment tree over the bin capacities.
+// Karmarkar-Karp merges sparse partial schedules (only non-empty machines are
+// stored) out of a heap; a merge of two full schedules costs O(m log m), so it
+// is the slow member of the portfolio for large m. The polish step repeatedly
+// moves a job off the most loaded machine, or swaps it for a shorter one,
+// whenever that lowers the larger of the two loads; the sum of squared loads
+// drops with every move, so it terminates. It is skipped when the construction
+// already meets the lower bound.
+//
+// gap is relative to max(max t, ceil(S/m)); status is "optimal" when the
+// makespan meets that bound and "heuristic" otherwise.
+class FreeOrderHeuristicSolver {
+public:
+    explicit FreeOrderHeuristicSolver(FreeOrderHeuristic heuristic,
+                                      const FreeOrderOptions& options = FreeOrderOptions())
+        : heuristic_(heuristic), options_(options) {}
+
+    PseudoPolySolution solve(const std::vector<int>& times, int m,
+                             bool is_test_mode = false);
+
+    // Name used in the console and JSON output: "lpt", "multifit", "karmarkar_karp"
+    static std::string name(FreeOrderHeuristic heuristic);
+
+    static long long lowerBound(const std::vector<int>& times, int m);
+
+private:
+    FreeOrderHeuristic heuristic_;
+    FreeOrderOptions options_;
+
+    std::vector<int> byDecreasingTime(const std::vector<int>& times) const;
+    void assignLPT(const std::vector<int>& times, int m, std::vector<int>& machine) const;
+    void assignMultifit(const std::vector<int>& times, int m, long long lower,
+                        std::vector<int>& machine) const;
+    void assignKarmarkarKarp(const std::vector<int>& times, int m, std::vector<int>& machine) const;
+    void polish(const std::vector<int>& times, int m, std::vector<int>& machine) const;
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef HETEROGENEOUS_PARTITION_HPP
+#define HETEROGENEOUS_PARTITION_HPP
+
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+// Contiguous partitioning onto machines of different speeds in a fixed order:
+// block j runs on machine j and takes load_j / s_j wall-clock time. Slow machines
+// may stay idle, so split_points always has m + 1 entries and blocks can be empty.
+// makespan is wall-clock time; machine_loads stay in processing-time units.
+//
+// Speeds are kept exactly as integer units of 1e-6 (reduced by their gcd), so a
+// makespan T = L / u_i is the fraction (L, u_i) and every comparison is an exact
+// cross-multiplication. A probe at T is the usual greedy jump with capacity
+// floor(T u_j) on machine j; it returns either the largest block time (feasible)
+// or the smallest (load_j + next job) / u_j (infeasible), both candidates of the
+// form P[b] - P[a] over u_j. The search bisects between those snapped bounds,
+// starting from [max(max t / u_max, S / sum u), S / u_max], until they meet at T*.
+class HeterogeneousPartitionSolver {
+public:
+    static constexpr long long kSpeedResolution = 1000000;  // Speed units per 1.0
+
+    HeterogeneousPartitionSolver() = default;
+
+    // speeds[j] > 0 is the speed factor of machine j, 1.0 = reference machine
+    PseudoPolySolution solve(const std::vector<int>& times, const std::vector<double>& speeds,
+                             bool is_test_mode = false);
+
+private:
+    // Makespan load / units, compared by cross-multiplication
+    struct Fraction {
+        long long load;
+        long long units;
+    };
+
+    std::vector<long long> prefix_;          // prefix_[i] = t_0 + ... + t_{i-1}
+    std::vector<long long> units_;           // Integer speed of each machine, gcd-reduced
+
+    static bool less(const Fraction& a, const Fraction& b);
+    bool probe(__int128 numerator, __int128 denominator, Fraction& candidate) const;
+    void splitPoints(const Fraction& T, std::vector<int>& split_points) const;
+};
+
+#endif
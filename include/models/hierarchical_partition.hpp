@@ -0,0 +1,52 @@
+#ifndef HIERARCHICAL_PARTITION_HPP
+#define HIERARCHICAL_PARTITION_HPP
+
+#include <string>
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+// Two-level contiguous schedule: the chain is split across nodes, and each node's
+// segment across its cores. Always `nodes` entries per level, padded with empty
+// nodes and cores at the end when fewer are needed.
+struct HierarchicalSolution {
+    double makespan = -1.0;                           // Largest core load, transfers included
+    std::vector<int> node_split_points;               // Node k holds [node_split_points[k], node_split_points[k + 1])
+    std::vector<std::vector<int>> core_split_points;  // Per node: cores_per_node + 1 absolute positions
+    std::vector<std::vector<long long>> core_loads;   // Per node: work plus node-boundary transfers
+    int nodes = 0;
+    int cores_per_node = 0;
+    long long node_transfer_cost = 0;
+    double solve_time = 0.0;
+    int feasibility_checks = 0;
+    std::string status;
+};
+
+// Chain partitioning over `nodes` nodes of `cores_per_node` cores. Moving between
+// cores of one node is free; each edge between two nodes costs node_transfer_cost,
+// paid by the first core of the receiving node and the last core of the sending
+// one. The bottleneck core load is minimized exactly.
+//
+// With fixed per-core capacities the greedy furthest reach is exact at both
+// levels: a node ends furthest by filling its cores greedily with capacities
+// (T - cost, T, ..., T - cost), or without the last reduction when it can reach
+// the end of the chain. The flat optimum over nodes * cores machines is a lower
+// bound, and its blocks grouped by node stay within 2 * cost of it, so T* is
+// bisected over that window with O(nodes * cores log n) probes.
+class HierarchicalPartitionSolver {
+public:
+    HierarchicalPartitionSolver() = default;
+
+    HierarchicalSolution solve(const std::vector<int>& times, int nodes, int cores_per_node,
+                               long long node_transfer_cost, bool is_test_mode = false);
+
+private:
+    PseudoPolynomialSolver flat_solver_;     // Lower bound from the flat partition
+    std::vector<long long> prefix_;          // prefix_[i] = t_0 + ... + t_{i-1}
+
+    int fillNode(int start, long long T, int cores, long long in_cost, long long out_cost,
+                 std::vector<int>* core_ends) const;
+    bool probe(long long T, int nodes, int cores, long long cost,
+               HierarchicalSolution* solution) const;
+};
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef HIGH_MULTIPLICITY_HPP
+#define HIGH_MULTIPLICITY_HPP
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Jobs grouped by processing time, longest class first
+struct JobHistogram {
+    std::vector<int> sizes;                  // Distinct processing times, decreasing
+    std::vector<long long> counts;           // counts[c] jobs of time sizes[c]
+
+    static JobHistogram fromTimes(const std::vector<int>& times);
+};
+
+// Solution with free job order (P||Cmax): each machine receives a count per class
+struct HighMultiplicitySolution {
+    double makespan = -1.0;                          // Best makespan found
+    long long lower_bound = 0;                       // Proven lower bound on the optimum
+    std::vector<int> sizes;                          // Class sizes, as in JobHistogram
+    std::vector<std::vector<long long>> machine_counts;  // machine_counts[k][c]: jobs of class c on machine k
+    std::vector<long long> machine_loads;            // Load of each machine
+    std::vector<int> job_machine;                    // Machine of each job (times overload only)
+    double solve_time = 0.0;                         // Solution time in seconds
+    long long nodes = 0;                             // Search nodes over all makespans tried
+    std::string status;                              // "optimal", "feasible" (node limit) or an error
+
+    bool isValid() const { return status == "optimal" || status == "feasible"; }
+};
+
+// Exact engine for schedules where jobs may be reordered freely.
+//
+// Works on the histogram of processing times, so its search depends on the
+// number of classes (at most 24 in production) and not on n. For each makespan
+// T from the lower bound upward (in steps of the gcd of the sizes) it decides
+// whether the count vector can be packed into m bins of capacity T:
+//
+//   - every bin is completed around the longest remaining job and takes a
+//     maximal configuration (nothing left over still fits), which is safe since
+//     any job that fits can be moved into the free space;
+//   - the total free space m T - S bounds the waste of each completed bin;
+//   - remaining count vectors already shown infeasible are memoized.
+//
+// The first descent is the greedy longest-first fill, which succeeds at
+// ceil(S/m) + max t, so T never passes that value. A search that exceeds the
+// node limit cannot prove a makespan infeasible; the result then carries status
+// "feasible" with the proven lower bound.
+class HighMultiplicitySolver {
+public:
+    explicit HighMultiplicitySolver(long long node_limit = 1000000) : node_limit_(node_limit) {}
+
+    HighMultiplicitySolution solve(const std::vector<int>& times, int m,
+                                   bool is_test_mode = false);
+    HighMultiplicitySolution solve(const JobHistogram& histogram, int m);
+
+private:
+    struct VectorHash {
+        size_t operator()(const std::vector<long long>& key) const;
+    };
+
+    long long node_limit_;
+    long long nodes_ = 0;
+    long long node_budget_ = 0;                     // node_limit_ plus one greedy descent
+    bool aborted_ = false;
+    long long capacity_ = 0;
+    std::vector<int> sizes_;
+    std::vector<long long> remaining_;
+    std::vector<long long> config_;
+    std::vector<std::vector<long long>> bins_;      // Configurations on the current path
+    std::unordered_set<std::vector<long long>, VectorHash> failed_;
+
+    static long long lowerBound(const JobHistogram& histogram, int m, long long total);
+    bool packBins(int bins_left, long long waste_left);
+    bool fillBin(size_t c, long long free, long long rest, int bins_left, long long waste_left,
+                 bool take_first);
+};
+
+#endif
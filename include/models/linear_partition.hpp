@@ -0,0 +1,28 @@
+#ifndef LINEAR_PARTITION_HPP
+#define LINEAR_PARTITION_HPP
+
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+// Frederickson-style engine for very long chains.
+//
+// The optimal makespan is one of the prefix-sum differences P[j] - P[i], which form
+// an implicit n x n matrix sorted along rows and columns. The engine searches that
+// matrix the Frederickson-Johnson way: it repeatedly quarters the surviving
+// submatrices, probes the median of their corner values and discards every
+// submatrix the probe rules out. Candidate work is O(n) over all levels and only
+// O(log n) probes of O(m log n) each are needed, independent of the value range.
+class LinearPartitionSolver {
+public:
+    LinearPartitionSolver() = default;
+    
+    PseudoPolySolution solve(const std::vector<int>& times, int m,
+                         bool is_test_mode = false);
+    
+private:
+    std::vector<long long> prefix_;  // prefix_[i] = t_0 + ... + t_{i-1}
+    
+    long long searchSortedMatrix(int m, long long lower, long long upper, int& checks) const;
+};
+
+#endif
@@ -2,15 +2,14 @@
 #define MILP_SOLVER_HPP
 
 #include <vector>
-#include <map>
 #include <string>
 
 // Solution structure for MILP model
 struct MILPSolution {
     std::string status;                       // "optimal", "infeasible", "error", "time_limit"
     double makespan;                          // Optimal C_max value
-    std::map<int, std::vector<int>> assignments;  // Job assignments per machine
-    std::vector<int> machine_loads;           // Load of each machine
+    std::vector<int> split_points;            // Block k holds jobs [split_points[k], split_points[k + 1])
+    std::vector<long long> machine_loads;     // Load of each machine
     double solve_time;                        // Solution time in seconds
     double gap;                               // Final optimality gap
     int iterations;                           // Number of iterations
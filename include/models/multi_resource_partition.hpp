@@ -0,0 +1,67 @@
+#ifndef MULTI_RESOURCE_PARTITION_HPP
+#define MULTI_RESOURCE_PARTITION_HPP
+
+#include <string>
+#include <vector>
+
+// Contiguous blocks scored over several resources at once
+struct MultiResourceSolution {
+    double makespan = -1.0;                            // Largest load / capacity over machines and resources
+    std::vector<int> split_points;                     // Block k holds jobs [split_points[k], split_points[k + 1])
+    std::vector<std::vector<long long>> resource_loads;  // resource_loads[r][k]: use of resource r on machine k
+    int bottleneck_resource = -1;                      // Resource that sets the makespan
+    double solve_time = 0.0;
+    int feasibility_checks = 0;
+    std::string status;
+};
+
+// Chain partitioning with d resource values per job, given struct-of-arrays as
+// resources[r][j]. Resource 0 is the processing time (positive), the others are
+// non-negative. Machine k scores max_r load_r(k) / capacities[r] and the largest
+// score over the machines is minimized.
+//
+// The probe keeps one prefix row per position with the d sums side by side, so a
+// block end is one binary search whose steps compare a whole row against the d
+// limits: four resources per AVX2 compare (masked for the tail), a scalar loop
+// otherwise. A makespan is the exact fraction load / capacity and the search
+// bisects between snapped candidates as the heterogeneous engine does: the
+// largest block score when feasible, else the smallest score a block reaches by
+// taking its next job. Candidates are fractions with a capacity as denominator,
+// so the number of probes is polynomial in the input size.
+class MultiResourcePartitionSolver {
+public:
+    MultiResourcePartitionSolver() = default;
+
+    MultiResourceSolution solve(const std::vector<std::vector<int>>& resources, int m,
+                                const std::vector<long long>& capacities,
+                                bool is_test_mode = false);
+
+    // Whether the AVX2 row compare is used on this CPU
+    static bool usesAvx2();
+
+private:
+    // Score load / capacity, compared by cross-multiplication
+    struct Fraction {
+        long long load;
+        long long units;
+    };
+
+    // Whether every resource of a prefix row is within the limits
+    using RowCheck = bool (*)(const long long* row, const long long* limits, int resources);
+
+    static constexpr long long kMaxCapacity = 1000000000;
+
+    RowCheck fits_ = nullptr;                // Scalar or AVX2, chosen per solve
+    int resources_ = 0;
+    std::vector<long long> prefix_;          // prefix_[j * d + r] = sum of resource r over jobs [0, j)
+    std::vector<long long> capacities_;
+    std::vector<long long> limits_;          // Per-block scratch: row limits of the open block
+
+    static bool less(const Fraction& a, const Fraction& b);
+    const long long* row(int position) const { return prefix_.data() + static_cast<size_t>(position) * resources_; }
+    int blockEnd(int start, __int128 numerator, __int128 denominator);
+    Fraction score(int start, int end) const;
+    bool probe(__int128 numerator, __int128 denominator, int m, Fraction& candidate);
+};
+
+#endif
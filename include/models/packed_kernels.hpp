@@ -0,0 +1,35 @@
+#ifndef PACKED_KERNELS_HPP
+#define PACKED_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Greedy feasibility kernels over byte-packed processing times (t_i <= 255).
+// The AVX2 path handles 32 jobs per step: whole chunks that fit into the current
+// block are skipped with one horizontal sum, otherwise an in-register prefix sum
+// locates the block boundary. The path is chosen once at runtime.
+namespace PackedKernels {
+
+    bool hasAvx2();
+    
+    void packTimes(const std::vector<int>& times, std::vector<uint8_t>& packed);
+    
+    // Same contract as PrefixPartition::probeCandidate, in one streaming pass
+    bool probeCandidate(const uint8_t* times, size_t n, int T, int m, int& candidate);
+    
+    // k thresholds in one pass over the times; the AVX2 path keeps 8 greedy
+    // states in the lanes of a vector register and feeds them the same job
+    void probeCandidates(const uint8_t* times, size_t n, const int* T, int k, int m,
+                         char* feasible, int* candidates);
+    
+    // Explicit paths, used by the dispatchers above and for cross-checking
+    bool probeCandidateScalar(const uint8_t* times, size_t n, int T, int m, int& candidate);
+    bool probeCandidateAvx2(const uint8_t* times, size_t n, int T, int m, int& candidate);
+    void probeCandidatesScalar(const uint8_t* times, size_t n, const int* T, int k, int m,
+                               char* feasible, int* candidates);
+    void probeCandidatesAvx2(const uint8_t* times, size_t n, const int* T, int k, int m,
+                             char* feasible, int* candidates);
+}
+
+#endif
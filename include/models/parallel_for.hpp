@@ -0,0 +1,58 @@
+#ifndef PARALLEL_FOR_HPP
+#define PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Splits [0, count) into `workers` contiguous ranges and runs fn(worker, begin, end)
+// on each, the first range on the calling thread. Runs inline for a single worker.
+template <typename Fn>
+void parallelFor(int workers, size_t count, Fn fn) {
+    workers = static_cast<int>(std::min<size_t>(std::max(workers, 1), std::max<size_t>(count, 1)));
+    if (workers == 1) {
+        fn(0, size_t(0), count);
+        return;
+    }
+    
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (int w = 1; w < workers; w++) {
+        size_t begin = count * w / workers;
+        size_t end = count * (w + 1) / workers;
+        pool.emplace_back(fn, w, begin, end);
+    }
+    fn(0, size_t(0), count / workers);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+}
+
+// Folds fn(begin, end) over the ranges of parallelFor into init with combine.
+// Runs inline, without allocating, for a single worker.
+template <typename T, typename Fn, typename Combine>
+T parallelReduce(int workers, size_t count, T init, Fn fn, Combine combine) {
+    workers = static_cast<int>(std::min<size_t>(std::max(workers, 1), std::max<size_t>(count, 1)));
+    if (workers == 1) {
+        return combine(init, fn(size_t(0), count));
+    }
+    
+    std::vector<T> partial(workers, init);
+    parallelFor(workers, count, [&](int worker, size_t begin, size_t end) {
+        partial[worker] = fn(begin, end);
+    });
+    for (const T& value : partial) {
+        init = combine(init, value);
+    }
+    return init;
+}
+
+// Worker count for an option value: 0 means one per hardware thread
+inline int resolveWorkers(int requested) {
+    if (requested > 0) return requested;
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? static_cast<int>(hardware) : 1;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef PIPELINE_PARTITION_HPP
+#define PIPELINE_PARTITION_HPP
+
+#include <vector>
+#include "models/pseudo_polynomial.hpp"
+
+// Chain-to-pipeline mapping with communication costs. comm[i] >= 0 is paid when
+// jobs i and i + 1 run on different machines, by both of them: stage [a, b]
+// costs P[b + 1] - P[a] + comm[a - 1] (if a > 0) + comm[b] (if b < n - 1), and
+// the bottleneck stage is minimized over at most m stages. machine_loads holds
+// these stage costs, transfers included.
+//
+// Greedy furthest reach is not exact here, since the furthest end may leave an
+// expensive edge for the next stage. The probe is instead a min-stages DP in
+// one pass: stage [a, b] fits T iff key(a) = P[a] - comm[a - 1] is at least
+// P[b + 1] + comm[b] - T, so for each count g < m of stages behind a start only
+// the largest key matters. A max segment tree over those m slots answers "fewest
+// stages before a start that fits" in O(log m), so a probe is O(n log m) with
+// O(m) memory beyond the prefix sums. The makespan is bisected between the
+// optimum without transfers and the cost of those same blocks with transfers,
+// a range no wider than 2 max(comm).
+class PipelinePartitionSolver {
+public:
+    PipelinePartitionSolver() = default;
+
+    // comm must hold n - 1 non-negative costs, comm[i] between jobs i and i + 1
+    PseudoPolySolution solve(const std::vector<int>& times, const std::vector<int>& comm, int m,
+                             bool is_test_mode = false);
+
+    // Whether bottleneck T is reachable with at most m stages, for the chain of
+    // the last solve
+    bool isFeasible(long long T, int m);
+
+private:
+    PseudoPolynomialSolver work_solver_;     // Bounds from the transfer-free optimum
+    std::vector<long long> prefix_;          // prefix_[i] = t_0 + ... + t_{i-1}
+    std::vector<int> comm_;
+    std::vector<long long> best_key_;        // Segment tree over stage counts: largest key
+    std::vector<int> best_start_;            // Start holding that key, per leaf
+    std::vector<int> parent_;                // Start of the stage ending before each position
+    int leaves_ = 1;
+
+    long long stageCost(int start, int end) const;
+    long long key(int start) const;
+    long long endCost(int end) const;
+    bool probe(long long T, int m, bool record);
+    void insert(int stages, long long value, int start);
+    int firstAtLeast(long long threshold) const;
+};
+
+#endif
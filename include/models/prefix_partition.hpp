@@ -0,0 +1,61 @@
+#ifndef PREFIX_PARTITION_HPP
+#define PREFIX_PARTITION_HPP
+
+#include <cstdint>
+#include <vector>
+
+// Greedy contiguous-partition primitives shared by the solvers.
+// prefix[i] = t_0 + ... + t_{i-1}, so jobs [a, b) carry prefix[b] - prefix[a].
+//
+// Templated over the time type TimeT and the accumulator type AccT used for the
+// prefix sums and makespans; the caller guarantees prefix.back() + T fits AccT.
+// Instantiated in prefix_partition.cpp for AccT in {int, long long, uint32_t,
+// uint64_t}, with int times for the prefix-sum builders.
+namespace PrefixPartition {
+
+    template <typename TimeT, typename AccT>
+    void buildPrefixSums(const std::vector<TimeT>& times, std::vector<AccT>& prefix);
+    
+    // Parallel scan: per-chunk totals, a scan over the totals, then per-chunk fill
+    template <typename TimeT, typename AccT>
+    void buildPrefixSums(const std::vector<TimeT>& times, std::vector<AccT>& prefix, int workers);
+    
+    // Largest j with prefix[j] - prefix[start] <= T; equals start if job `start` alone exceeds T
+    template <typename AccT>
+    int nextBoundary(const std::vector<AccT>& prefix, int start, AccT T);
+    
+    // Greedy check with block-to-block jumps: O(m log n)
+    template <typename AccT>
+    bool isFeasible(const std::vector<AccT>& prefix, AccT T, int m);
+    
+    // Same greedy as isFeasible, but also reports the nearest makespan at which the
+    // greedy blocks change: the largest block load if T is feasible, otherwise the
+    // smallest (block load + next job), below which the m blocks still overflow
+    template <typename AccT>
+    bool probeCandidate(const std::vector<AccT>& prefix, AccT T, int m, AccT& candidate);
+    
+    // probeCandidate for k thresholds at once: the greedy cursors advance in
+    // lockstep (eight at a time), so the binary searches of one step overlap
+    // their memory accesses
+    template <typename AccT>
+    void probeCandidates(const std::vector<AccT>& prefix, const AccT* T, int k, int m,
+                         char* feasible, AccT* candidates);
+    
+    // Greedy blocks for makespan T (at most m of them when T is feasible) as split
+    // points: block b holds jobs [split_points[b], split_points[b + 1]), the first
+    // entry is 0 and the last is n. O(blocks log n), no per-job output; reuses the
+    // capacity of split_points.
+    template <typename AccT>
+    void greedySplitPoints(const std::vector<AccT>& prefix, AccT T, std::vector<int>& split_points);
+    
+    template <typename AccT>
+    std::vector<long long> blockLoads(const std::vector<AccT>& prefix,
+                                      const std::vector<int>& split_points);
+    
+    // Same loads written into `loads`, reusing its capacity
+    template <typename AccT>
+    void blockLoads(const std::vector<AccT>& prefix, const std::vector<int>& split_points,
+                    std::vector<long long>& loads);
+}
+
+#endif
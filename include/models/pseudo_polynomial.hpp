@@ -3,29 +3,150 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
 
 struct PseudoPolySolution {
     double makespan;                         // Optimal makespan
-    std::vector<std::vector<int>> partition; // Partition of jobs
-    std::vector<int> machine_loads;          // Load of each machine
+    std::vector<int> split_points;           // Block k holds jobs [split_points[k], split_points[k + 1])
+    std::vector<long long> machine_loads;    // Load of each machine
     double solve_time;                       // Solution time in seconds
-    int feasibility_checks;                  // Number of feasibility checks
+    int feasibility_checks;                  // Number of feasibility probes (passes over the data)
     std::string status;                      // Solution status
+    std::vector<int> job_order;              // Free-order engines: blocks index into this order
+    double gap = 0.0;                        // Free-order heuristics: gap to the lower bound
+    std::vector<int> witness;                // With PseudoPolyOptions::certificate: m + 1 greedy
+                                             // ends at makespan - 1 that stop short of n
     
     // Add this method:
     bool isValid() const { return true; } // Или другая логика проверки
 };
 
+// Capacity planning answers computed on one set of prefix sums
+struct CapacityProfile {
+    std::vector<long long> makespan_by_machines;  // T*(k) for k = 1..M, at index k - 1
+    long long target_makespan = 0;           // Target of the inverse query
+    int min_machines = -1;                   // Fewest machines meeting the target, -1 if none can
+    int feasibility_checks = 0;              // Probes spent on the whole curve
+    double solve_time = 0.0;                 // Solution time in seconds
+};
+
+// Input checks shared by the pseudo-polynomial engines: n > m, positive times and,
+// outside test mode, at least 50 jobs. The time scan is split over `workers` threads.
+bool validateInput(const std::vector<int>& times, int m,
+                   std::string& error_msg, bool is_test_mode = false, int workers = 1);
+
+// Strategy used to locate the optimal makespan
+enum class SearchMode {
+    Bisection,   // Integer bisection between max(t) and sum(t)
+    Parametric   // Bounded search that only moves between candidate makespans
+};
+
+// How a single feasibility probe is evaluated
+enum class ProbeKernel {
+    Auto,         // Prefix jumps unless m log n outweighs a streaming pass; FixedM for small m
+    PrefixJumps,  // O(m log n) upper_bound jumps over the prefix sums
+    PackedScan,   // Streaming greedy over uint8_t times, AVX2 when available
+    FixedM        // Prefix jumps specialized per m <= 16, unrolled and allocation-free
+};
+
+struct PseudoPolyOptions {
+    SearchMode search_mode = SearchMode::Parametric;
+    ProbeKernel probe_kernel = ProbeKernel::Auto;
+    int probe_lanes = 1;  // Thresholds tested per probe; k > 1 makes the search k-ary
+    int threads = 1;      // Worker threads for large instances, 0 = one per hardware thread.
+                          // They split the input scans and the prefix sums, and each probe
+                          // tests at least one threshold per worker, so the search is
+                          // (threads + 1)-ary even with probe_lanes = 1
+    int parallel_min_jobs = 10000000;  // Smallest n that uses the worker threads
+    bool certificate = false;  // Also record the witness that makespan - 1 is infeasible
+};
+
+// Engine for one storage width: times are kept as TimeT and prefix sums, makespans
+// and probe candidates as AccT. The caller validates the input and checks fits()
+// first. Instantiated in pseudo_polynomial.cpp for the two widths named below.
+//
+// The engine is its own workspace: every buffer it owns only grows, so repeated
+// solves of instances no larger than earlier ones, written into a reused
+// PseudoPolySolution, make no heap allocations (with a single worker thread).
+template <typename TimeT, typename AccT>
+class BasicPseudoPolynomialSolver {
+public:
+    explicit BasicPseudoPolynomialSolver(const PseudoPolyOptions& options = PseudoPolyOptions())
+        : options_(options) {}
+    
+    // True when times up to max_time and a total of `total` fit TimeT and AccT
+    // with room for prefix[i] + T, and for the int-based packed kernels
+    static bool fits(long long max_time, long long total);
+    
+    PseudoPolySolution solve(const std::vector<int>& times, int m);
+    
+    // Same solve written into `result`, reusing the capacity of its vectors
+    void solve(const std::vector<int>& times, int m, PseudoPolySolution& result);
+    
+    // T*(k) for every k in [1, max_machines] plus the fewest machines whose optimal
+    // makespan is at most target_makespan. The curve is non-increasing, so it is
+    // split in the middle and each half searched only between the neighbouring
+    // known values; runs of equal makespans are filled without probing.
+    CapacityProfile capacityProfile(const std::vector<int>& times, int max_machines,
+                                    long long target_makespan);
+    
+private:
+    PseudoPolyOptions options_;
+    ProbeKernel kernel_ = ProbeKernel::PrefixJumps;  // Kernel resolved for the current solve
+    int workers_ = 1;                        // Threads resolved for the current solve
+    int lanes_ = 1;                          // Thresholds per probe for the current solve
+    std::vector<TimeT> times_;               // Times narrowed to TimeT; the packed scan reads these
+    std::vector<AccT> prefix_;               // prefix_[i] = t_0 + ... + t_{i-1}, built once per solve
+    
+    std::vector<AccT> thresholds_;           // Per-lane scratch of the current probe
+    std::vector<char> lane_feasible_;
+    std::vector<AccT> lane_candidates_;
+    std::vector<int> packed_thresholds_;     // int copies for the packed kernels
+    std::vector<int> packed_candidates_;
+    
+    void loadTimes(const std::vector<int>& times);
+    ProbeKernel selectKernel(int n, int m) const;
+    void probeThresholds(int m);
+    AccT searchRange(AccT left, AccT right, int m, bool snap, int& checks);
+    AccT findOptimalMakespan(int m, int& checks);
+    void fillCurve(int first, int last, AccT lower, AccT upper, AccT max_time,
+                   CapacityProfile& profile);
+    int minMachines(AccT target) const;
+};
+
+// Times up to 255 with a total below INT_MAX: byte times, 32-bit sums, packed kernels
+using NarrowPseudoPolySolver = BasicPseudoPolynomialSolver<uint8_t, uint32_t>;
+// Everything else an int time vector can hold
+using WidePseudoPolySolver = BasicPseudoPolynomialSolver<uint32_t, uint64_t>;
+
+// Validates the input and runs the narrowest engine the instance fits
 class PseudoPolynomialSolver {
 public:
+    PseudoPolynomialSolver() = default;
+    explicit PseudoPolynomialSolver(const PseudoPolyOptions& options)
+        : options_(options), narrow_(options), wide_(options) {}
+    
     PseudoPolySolution solve(const std::vector<int>& times, int m,
                          bool is_test_mode = false);
     
+    // Allocation-free form for hot loops: keep one solver and one result per
+    // thread and solve into the result again and again
+    void solve(const std::vector<int>& times, int m, PseudoPolySolution& result,
+               bool is_test_mode = false);
+    
+    CapacityProfile capacityProfile(const std::vector<int>& times, int max_machines,
+                                    long long target_makespan);
+    
+    // Whether the last call ran the narrow engine
+    bool usedNarrowPath() const { return used_narrow_; }
+    
 private:
-    bool isFeasible(int T, const std::vector<int>& times, int m);
-    int findOptimalMakespan(const std::vector<int>& times, int m, int& checks);
-    std::vector<std::vector<int>> reconstructPartition(const std::vector<int>& times, 
-                                                      int m, int T_opt);
+    PseudoPolyOptions options_;
+    NarrowPseudoPolySolver narrow_;
+    WidePseudoPolySolver wide_;
+    bool used_narrow_ = false;
+    
+    bool selectNarrow(const std::vector<int>& times, int workers);
 };
 
-#endif
\ No newline at end of file
+#endif
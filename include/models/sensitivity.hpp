@@ -0,0 +1,33 @@
+#ifndef SENSITIVITY_HPP
+#define SENSITIVITY_HPP
+
+#include <string>
+#include <vector>
+
+// How far each job can slow down before the optimal makespan moves
+struct SensitivityReport {
+    long long makespan = -1;                 // T* of the unchanged chain
+    std::vector<long long> slack;            // slack[i]: largest growth of t_i that keeps T*
+    std::vector<int> critical_ranges;        // Runs of zero-slack jobs, as [start, end) pairs
+    int critical_jobs = 0;                   // Jobs with zero slack
+    double solve_time = 0.0;
+    int feasibility_checks = 0;
+    std::string status;
+};
+
+// Per-job slack in one pass after a single solve. Job i keeps T* while it fits
+// in some block [a, b) with a <= i < b, P[b] - P[a] + delta <= T*, and the jobs
+// before a and after b covered by the m - 1 other blocks. The fewest blocks for
+// [0, a) and [b, n) at T* come from the greedy boundaries in both directions, so
+// slack[i] = T* - (lightest such block). As a grows, the earliest usable end b
+// never moves left, so every job is answered with one pointer and a sliding
+// window minimum: O(n log m) after the solve. Zero-slack jobs are critical: any
+// growth of one of them raises T*.
+class SensitivityAnalyzer {
+public:
+    SensitivityAnalyzer() = default;
+
+    SensitivityReport analyze(const std::vector<int>& times, int m, bool is_test_mode = false);
+};
+
+#endif
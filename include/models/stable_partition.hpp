@@ -0,0 +1,63 @@
+#ifndef STABLE_PARTITION_HPP
+#define STABLE_PARTITION_HPP
+
+#include <string>
+#include <vector>
+
+// Re-optimized partition that keeps as many jobs as possible on their machine
+struct StableRepartition {
+    long long makespan = -1;                 // Largest block load of the chosen partition
+    long long optimal_makespan = -1;         // T* of the new conditions
+    std::vector<int> split_points;           // m + 1 entries, blocks may be empty
+    std::vector<long long> machine_loads;
+    long long jobs_moved = 0;                // Jobs whose machine changed
+    long long resolve_jobs_moved = 0;        // Same count for the greedy blocks of a plain re-solve
+    double solve_time = 0.0;
+    int feasibility_checks = 0;
+    std::string status;
+};
+
+// Re-optimization after a machine drops out or joins, or job times drift. The
+// previous partition has m' blocks over the same n jobs; machine_map[k] names
+// the previous block whose machine runs new block k, or -1 for a fresh machine.
+// Mapped blocks must stay in chain order. An empty map keeps machines 0..min(m,
+// m') - 1 and adds fresh ones at the end. Among all partitions with makespan
+// at most T* + max_increase, the one moving the fewest jobs is returned.
+//
+// A job of previous block [a, b) that runs on new block k stays iff s_k <= j <
+// s_{k+1}, so it moves for s_k - a (clamped to [0, b - a)) jobs on the left and
+// b - s_{k+1} on the right. The migration is therefore a sum of one unimodal
+// cost per boundary, plus the jobs of dropped machines. Boundary k can only lie
+// between the backward and the forward greedy ends of k blocks at T, and a DP
+// over those windows with a sliding window minimum (block load <= T) finds the
+// best boundaries. Two greedy placements bound the optimum from above, so each
+// window is first cut to the positions that can still match that bound. The DP
+// then costs O(sum of window widths) after one prefix build and the T* search;
+// windows are narrow near T* and widen with max_increase. The moved count of a
+// plain re-solve comes from the block endpoints in O(m), not a per-job diff.
+class StablePartitionSolver {
+public:
+    StablePartitionSolver() = default;
+
+    StableRepartition solve(const std::vector<int>& times, int m,
+                            const std::vector<int>& previous_split_points,
+                            const std::vector<int>& machine_map = std::vector<int>(),
+                            long long max_increase = 0, bool is_test_mode = false);
+
+private:
+    std::vector<long long> prefix_;          // prefix_[i] = t_0 + ... + t_{i-1}
+    std::vector<int> first_;                 // Earliest boundary k, from the backward greedy
+    std::vector<int> last_;                  // Latest boundary k, from the forward greedy
+    std::vector<int> kept_start_;            // Previous block [start, end) of new block k,
+    std::vector<int> kept_end_;              // empty for a fresh machine
+    long long dropped_jobs_ = 0;             // Jobs of previous blocks left out of the map
+    std::vector<int> parent_;                // Best boundary k - 1 per candidate boundary k
+    std::vector<long long> offset_;          // Start of boundary k's candidates in parent_
+
+    long long boundaryCost(int k, int position) const;
+    int cheapest(int k, int low, int high) const;
+    void trim(int k, long long budget);
+    long long movedJobs(const std::vector<int>& split_points) const;
+};
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef STREAMING_SOLVER_HPP
+#define STREAMING_SOLVER_HPP
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Solution of a streamed chain: only block summaries are kept, never the times
+struct StreamingSolution {
+    double makespan = -1.0;                  // Optimal makespan
+    long long number_of_jobs = 0;            // Jobs read from the stream
+    std::vector<long long> split_points;     // Block k holds jobs [split_points[k], split_points[k + 1])
+    std::vector<long long> machine_loads;    // Load of each block
+    double solve_time = 0.0;                 // Solution time in seconds
+    int passes = 0;                          // Passes over the input, statistics pass included
+    std::string status;                      // Solution status
+};
+
+// Bounded-memory engine for chains that do not fit in RAM.
+//
+// Times are read as whitespace- or comma-separated integers in fixed-size chunks.
+// A first pass collects n, the total and the longest job; T* then lies in
+// [max(max t, ceil(S/m)), ceil(S/m) + max t], and every following pass runs the
+// greedy for up to kMaxLanes thresholds side by side, each lane holding only its
+// open block. For times bounded by kMaxLanes - 1 (the production range) a single
+// sweep covers every candidate and also records the split points, so the solve
+// takes two passes. Memory is O(chunk + lanes * m), independent of n. Standard
+// input cannot be rewound and is spooled to a temporary file during the first pass.
+class StreamingSolver {
+public:
+    static constexpr int kMaxLanes = 32;
+
+    explicit StreamingSolver(size_t chunk_bytes = 1 << 20) : chunk_bytes_(chunk_bytes) {}
+
+    // path "-" reads standard input
+    StreamingSolution solve(const std::string& path, int m);
+    StreamingSolution solve(std::FILE* input, int m);
+
+private:
+    struct Lane {
+        long long T;
+        long long load = 0;                     // Load of the open block
+        long long max_load = 0;                 // Largest closed block
+        long long next_candidate = -1;          // Smallest (closed load + next job), -1 if none
+        int blocks = 1;
+        bool feasible = true;
+        std::vector<long long> ends;            // Block ends, only while recording
+        std::vector<long long> loads;
+    };
+
+    size_t chunk_bytes_;
+
+    void sweep(std::FILE* data, std::vector<Lane>& lanes, int m, bool record) const;
+};
+
+#endif
@@ -18,6 +18,12 @@ struct ResultData {
     bool solutions_match;      // whether solutions match
     std::string status_milp;   // status of MILP solution
     std::string status_pseudo; // status of pseudo solution
+    double ms_lpt;             // free-order heuristics (-1 when absent)
+    double ms_multifit;
+    double ms_kk;
+    double gap_lpt;            // gap to max(max t, ceil(sum/m))
+    double gap_multifit;
+    double gap_kk;
 };
 
 class TableGenerator {
@@ -36,6 +42,9 @@ public:
     // Simple console output
     static void printConsoleTable(const std::vector<ResultData>& results);
     
+    // Free-order heuristics side by side, for results that contain them
+    static void printFreeOrderTable(const std::vector<ResultData>& results);
+    
 private:
     // Private helper methods for JSON parsing
     static double extractDouble(const std::string& json, const std::string& key);
@@ -29,6 +29,57 @@ namespace InputData {
         return times;
     }
     
+    std::vector<int> get_communication_costs(int number_of_jobs) {
+        
+        std::vector<int> costs(number_of_jobs > 0 ? number_of_jobs - 1 : 0);
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> distrib(0, 4);
+        
+        for (int& cost : costs) {
+            cost = distrib(gen);
+        }
+        return costs;
+    }
+    
+    std::vector<int> get_memory_bandwidth(int number_of_jobs) {
+        
+        std::vector<int> bandwidth(number_of_jobs);
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> distrib(0, 20);
+        
+        for (int& use : bandwidth) {
+            use = distrib(gen);
+        }
+        return bandwidth;
+    }
+    
+    std::vector<long long> get_resource_capacities() {
+        return {100, 100};
+    }
+    
+    std::vector<double> get_machine_speeds(int number_of_machines) {
+        // Mixed cluster: half reference machines, then 1.5x and 2x generations
+        std::vector<double> speeds(number_of_machines, 1.0);
+        for (int j = number_of_machines / 2; j < number_of_machines; j++) {
+            speeds[j] = (j < 4 * number_of_machines / 5) ? 1.5 : 2.0;
+        }
+        return speeds;
+    }
+    
+    int get_cores_per_node(int number_of_machines) {
+        for (int cores : {8, 4, 2}) {
+            if (number_of_machines % cores == 0) return cores;
+        }
+        return 1;
+    }
+    
+    int get_lost_machine(int number_of_machines) {
+        // The middle machine, so that both of its neighbours absorb its jobs
+        return number_of_machines / 2;
+    }
+    
     
     // ============================================
     // MILP PARAMETERS IMPLEMENTATIONS
@@ -38,12 +89,52 @@ namespace InputData {
         std::cout << "\nMILP Solver Parameters:" << std::endl;
         std::cout << "  Time limit: " << time_limit << " seconds" << std::endl;
         std::cout << "  MIP gap: " << mip_gap << " (" << (mip_gap * 100) << "%)" << std::endl;
+        std::cout << "  Skip if certified: " << (skip_if_certified ? "yes" : "no") << std::endl;
     }
     
     MILPParameters get_milp_parameters() {
         MILPParameters params;
         params.time_limit = 3600.0;  // in seconds
         params.mip_gap = 0.0;  
+        params.skip_if_certified = true;
+        return params;
+    }
+    
+    
+    // ============================================
+    // CAPACITY PLANNING PARAMETERS IMPLEMENTATIONS
+    // ============================================
+    
+    void CapacityParameters::print() const {
+        std::cout << "\nCapacity Planning Parameters:" << std::endl;
+        std::cout << "  Max machines: " << max_machines << std::endl;
+        std::cout << "  Target makespan: " << target_makespan << std::endl;
+    }
+    
+    CapacityParameters get_capacity_parameters() {
+        CapacityParameters params;
+        params.max_machines = 20;
+        params.target_makespan = 100;
+        return params;
+    }
+    
+    
+    // ============================================
+    // COARSENING PARAMETERS IMPLEMENTATIONS
+    // ============================================
+    
+    void CoarseningParameters::print() const {
+        std::cout << "\nCoarsening Parameters:" << std::endl;
+        std::cout << "  Group size: " << group_size << std::endl;
+        std::cout << "  Coarse jobs: " << coarse_jobs << std::endl;
+        std::cout << "  Max fine probes: " << max_fine_probes << std::endl;
+    }
+    
+    CoarseningParameters get_coarsening_parameters() {
+        CoarseningParameters params;
+        params.group_size = 64;
+        params.coarse_jobs = 65536;
+        params.max_fine_probes = 8;
         return params;
     }
-} 
\ No newline at end of file
+}
@@ -36,6 +36,16 @@ namespace OutputWriterJson {
         }
         return result;
     }
+    
+    std::string JsonWriter::blockRanges(const std::vector<int>& split_points) {
+        std::string ranges = "[";
+        for (size_t k = 0; k + 1 < split_points.size(); k++) {
+            if (k > 0) ranges += ", ";
+            ranges += "[" + std::to_string(split_points[k]) + ", " +
+                      std::to_string(split_points[k + 1]) + "]";
+        }
+        return ranges + "]";
+    }
 
     // ============================================
     // ALGORITHM RESULT CREATION METHODS (PUBLIC)
@@ -54,19 +64,9 @@ namespace OutputWriterJson {
             result.feasibility_checks = solution.feasibility_checks;
             result.gap = 0.0;
             
-            // Convert partition to assignments
-            for (size_t i = 0; i < solution.partition.size(); i++) {
-                result.assignments[static_cast<int>(i)] = solution.partition[i];
-                
-                // Calculate machine load
-                int load = 0;
-                for (int job_idx : solution.partition[i]) {
-                    if (job_idx >= 0 && job_idx < static_cast<int>(times.size())) {
-                        load += times[job_idx];
-                    }
-                }
-                result.machine_loads.push_back(load);
-            }
+            result.split_points = solution.split_points;
+            result.machine_loads = solution.machine_loads;
+            result.witness = solution.witness;
         } else {
             result.makespan = -1.0;
             result.solution_time = -1.0;
@@ -92,7 +92,7 @@ namespace OutputWriterJson {
         result.status = solution.status;
         result.gap = solution.gap;
         result.feasibility_checks = 0;
-        result.assignments = solution.assignments;
+        result.split_points = solution.split_points;
         result.machine_loads = solution.machine_loads;
     } else {
         result.makespan = -1.0;
@@ -105,6 +105,29 @@ namespace OutputWriterJson {
     return result;
 }
 
+    AlgorithmResult JsonWriter::createFreeOrderResult(
+        const std::string& name,
+        const PseudoPolySolution& solution) {
+        
+        AlgorithmResult result;
+        result.algorithm_name = name;
+        result.status = solution.status;
+        result.feasibility_checks = 0;
+        
+        if (solution.makespan >= 0) {
+            result.makespan = solution.makespan;
+            result.solution_time = solution.solve_time;
+            result.gap = solution.gap;
+            result.machine_loads = solution.machine_loads;
+        } else {
+            result.makespan = -1.0;
+            result.solution_time = -1.0;
+            result.gap = -1.0;
+        }
+        
+        return result;
+    }
+
     // ============================================
     // TEST RESULT CREATION
     // ============================================
@@ -151,9 +174,20 @@ namespace OutputWriterJson {
         } else {
             result.speedup = 0.0;
         }
+        result.validated_by = "milp";
         
         return result;
     }
+    
+    void JsonWriter::attachCertificate(TestResult& result, const CertificateCheck& certificate) {
+        result.certificate = certificate;
+        if (result.milp_result.status == "skipped_certified" && certificate.optimal() &&
+            result.pseudo_polynomial_result.makespan == static_cast<double>(certificate.makespan)) {
+            result.solutions_match = true;
+            result.makespan_difference = 0.0;
+            result.validated_by = "certificate";
+        }
+    }
 
     // ============================================
     // SINGLE RESULT JSON WRITING
@@ -182,19 +216,130 @@ namespace OutputWriterJson {
             json << "      \"makespan\": " << result.pseudo_polynomial_result.makespan << ",\n";
             json << "      \"solution_time\": " << result.pseudo_polynomial_result.solution_time << ",\n";
             json << "      \"status\": \"" << escapeJsonString(result.pseudo_polynomial_result.status) << "\",\n";
-            json << "      \"feasibility_checks\": " << result.pseudo_polynomial_result.feasibility_checks << "\n";
+            json << "      \"feasibility_checks\": " << result.pseudo_polynomial_result.feasibility_checks << ",\n";
+            json << "      \"blocks\": " << blockRanges(result.pseudo_polynomial_result.split_points) << "\n";
             json << "    },\n";
             json << "    \"milp\": {\n";
             json << "      \"makespan\": " << result.milp_result.makespan << ",\n";
             json << "      \"solution_time\": " << result.milp_result.solution_time << ",\n";
             json << "      \"status\": \"" << escapeJsonString(result.milp_result.status) << "\",\n";
-            json << "      \"gap\": " << result.milp_result.gap << "\n";
+            json << "      \"gap\": " << result.milp_result.gap << ",\n";
+            json << "      \"blocks\": " << blockRanges(result.milp_result.split_points) << "\n";
             json << "    }\n";
             json << "  },\n";
+            if (!result.capacity_profile.makespan_by_machines.empty()) {
+                const CapacityProfile& profile = result.capacity_profile;
+                json << "  \"capacity_planning\": {\n";
+                json << "    \"makespan_by_machines\": [";
+                for (size_t i = 0; i < profile.makespan_by_machines.size(); i++) {
+                    if (i > 0) json << ", ";
+                    json << profile.makespan_by_machines[i];
+                }
+                json << "],\n";
+                json << "    \"target_makespan\": " << profile.target_makespan << ",\n";
+                json << "    \"min_machines\": " << profile.min_machines << ",\n";
+                json << "    \"feasibility_checks\": " << profile.feasibility_checks << ",\n";
+                json << "    \"solution_time\": " << profile.solve_time << "\n";
+                json << "  },\n";
+            }
+            if (!result.free_order_results.empty()) {
+                json << "  \"free_order\": {\n";
+                for (size_t i = 0; i < result.free_order_results.size(); i++) {
+                    const AlgorithmResult& heuristic = result.free_order_results[i];
+                    json << "    \"" << escapeJsonString(heuristic.algorithm_name) << "\": {\n";
+                    json << "      \"makespan\": " << heuristic.makespan << ",\n";
+                    json << "      \"solution_time\": " << heuristic.solution_time << ",\n";
+                    json << "      \"status\": \"" << escapeJsonString(heuristic.status) << "\",\n";
+                    json << "      \"gap\": " << heuristic.gap << "\n";
+                    json << "    }" << (i + 1 < result.free_order_results.size() ? "," : "") << "\n";
+                }
+                json << "  },\n";
+            }
+            if (!result.hierarchical.core_split_points.empty()) {
+                const HierarchicalSolution& hierarchical = result.hierarchical;
+                json << "  \"hierarchical\": {\n";
+                json << "    \"nodes\": " << hierarchical.nodes << ",\n";
+                json << "    \"cores_per_node\": " << hierarchical.cores_per_node << ",\n";
+                json << "    \"node_transfer_cost\": " << hierarchical.node_transfer_cost << ",\n";
+                json << "    \"makespan\": " << hierarchical.makespan << ",\n";
+                json << "    \"solution_time\": " << hierarchical.solve_time << ",\n";
+                json << "    \"status\": \"" << escapeJsonString(hierarchical.status) << "\",\n";
+                json << "    \"feasibility_checks\": " << hierarchical.feasibility_checks << ",\n";
+                json << "    \"node_blocks\": [\n";
+                for (size_t k = 0; k < hierarchical.core_split_points.size(); k++) {
+                    json << "      {\n";
+                    json << "        \"jobs\": [" << hierarchical.node_split_points[k] << ", "
+                         << hierarchical.node_split_points[k + 1] << "],\n";
+                    json << "        \"cores\": " << blockRanges(hierarchical.core_split_points[k]) << ",\n";
+                    json << "        \"core_loads\": [";
+                    for (size_t core = 0; core < hierarchical.core_loads[k].size(); core++) {
+                        if (core > 0) json << ", ";
+                        json << hierarchical.core_loads[k][core];
+                    }
+                    json << "]\n";
+                    json << "      }" << (k + 1 < hierarchical.core_split_points.size() ? "," : "") << "\n";
+                }
+                json << "    ]\n";
+                json << "  },\n";
+            }
+            if (!result.sensitivity.slack.empty()) {
+                const SensitivityReport& sensitivity = result.sensitivity;
+                json << "  \"sensitivity\": {\n";
+                json << "    \"makespan\": " << sensitivity.makespan << ",\n";
+                json << "    \"solution_time\": " << sensitivity.solve_time << ",\n";
+                json << "    \"critical_jobs\": " << sensitivity.critical_jobs << ",\n";
+                json << "    \"critical_ranges\": [";
+                for (size_t k = 0; k + 1 < sensitivity.critical_ranges.size(); k += 2) {
+                    if (k > 0) json << ", ";
+                    json << "[" << sensitivity.critical_ranges[k] << ", "
+                         << sensitivity.critical_ranges[k + 1] << "]";
+                }
+                json << "],\n";
+                json << "    \"slack\": [";
+                for (size_t i = 0; i < sensitivity.slack.size(); i++) {
+                    if (i > 0) json << ",";
+                    json << sensitivity.slack[i];
+                }
+                json << "]\n";
+                json << "  },\n";
+            }
+            if (!result.stable.split_points.empty()) {
+                const StableRepartition& stable = result.stable;
+                json << "  \"stable_repartition\": {\n";
+                json << "    \"makespan\": " << stable.makespan << ",\n";
+                json << "    \"optimal_makespan\": " << stable.optimal_makespan << ",\n";
+                json << "    \"solution_time\": " << stable.solve_time << ",\n";
+                json << "    \"jobs_moved\": " << stable.jobs_moved << ",\n";
+                json << "    \"resolve_jobs_moved\": " << stable.resolve_jobs_moved << ",\n";
+                json << "    \"split_points\": [";
+                for (size_t k = 0; k < stable.split_points.size(); k++) {
+                    if (k > 0) json << ", ";
+                    json << stable.split_points[k];
+                }
+                json << "]\n";
+                json << "  },\n";
+            }
+            if (!result.pseudo_polynomial_result.witness.empty()) {
+                const CertificateCheck& certificate = result.certificate;
+                json << "  \"certificate\": {\n";
+                json << "    \"makespan\": " << certificate.makespan << ",\n";
+                json << "    \"partition_valid\": " << (certificate.partition_valid ? "true" : "false") << ",\n";
+                json << "    \"witness_valid\": " << (certificate.witness_valid ? "true" : "false") << ",\n";
+                json << "    \"message\": \"" << escapeJsonString(certificate.message) << "\",\n";
+                json << "    \"verify_time\": " << certificate.verify_time << ",\n";
+                json << "    \"witness\": [";
+                for (size_t k = 0; k < result.pseudo_polynomial_result.witness.size(); k++) {
+                    if (k > 0) json << ", ";
+                    json << result.pseudo_polynomial_result.witness[k];
+                }
+                json << "]\n";
+                json << "  },\n";
+            }
             json << "  \"comparison\": {\n";
             json << "    \"solutions_match\": " << (result.solutions_match ? "true" : "false") << ",\n";
             json << "    \"makespan_difference\": " << result.makespan_difference << ",\n";
-            json << "    \"speedup\": " << result.speedup << "\n";
+            json << "    \"speedup\": " << result.speedup << ",\n";
+            json << "    \"validated_by\": \"" << result.validated_by << "\"\n";
             json << "  }\n";
             json << "}";
             
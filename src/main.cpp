@@ -5,14 +5,59 @@
 #include <ctime>
 #include "models/milp_solver.hpp"
 #include "models/pseudo_polynomial.hpp"
+#include "models/streaming_solver.hpp"
+#include "models/high_multiplicity.hpp"
+#include "models/free_order_heuristics.hpp"
+#include "models/heterogeneous_partition.hpp"
+#include "models/pipeline_partition.hpp"
+#include "models/circular_partition.hpp"
+#include "models/hierarchical_partition.hpp"
+#include "models/multi_resource_partition.hpp"
+#include "models/sensitivity.hpp"
+#include "models/partition_verifier.hpp"
+#include "models/stable_partition.hpp"
+#include "models/coarse_partition.hpp"
 #include "io/input_data.hpp"
 #include "io/output_writer_json.hpp"
 
-int main() {
+// Bounded-memory solve of a chain read from a file or stdin ("-")
+int run_streaming(const std::string& path, int m) {
+    std::cout << "\n=== Streaming Solve ===" << std::endl;
+    std::cout << "Input: " << (path == "-" ? "stdin" : path) << std::endl;
+    std::cout << "Number of machines (m): " << m << std::endl;
+    
+    StreamingSolver solver;
+    StreamingSolution solution = solver.solve(path, m);
+    if (solution.status != "optimal") {
+        std::cout << "   ✗ Streaming solve failed: " << solution.status << std::endl;
+        return 1;
+    }
+    
+    std::cout << "   ✓ Streaming solution found" << std::endl;
+    std::cout << "   Jobs: " << solution.number_of_jobs << std::endl;
+    std::cout << "   Makespan: " << solution.makespan << std::endl;
+    std::cout << "   Passes over input: " << solution.passes << std::endl;
+    std::cout << "   Solve time: " << solution.solve_time << " seconds" << std::endl;
+    for (size_t b = 0; b < solution.machine_loads.size(); b++) {
+        std::cout << "   Machine " << b << ": jobs [" << solution.split_points[b] << ", "
+                  << solution.split_points[b + 1] << "), load " << solution.machine_loads[b]
+                  << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
     std::cout << "==========================================" << std::endl;
     std::cout << "  Huawei Job Scheduling - Both Models     " << std::endl;
     std::cout << "==========================================" << std::endl;
     
+    // ============================================
+    // STREAMING MODE: --stream <file | ->
+    // ============================================
+    if (argc >= 3 && std::string(argv[1]) == "--stream") {
+        return run_streaming(argv[2], InputData::get_number_of_machines());
+    }
+    
     // ============================================
     // GENERATE TIMESTAMP
     // ============================================
@@ -30,6 +75,8 @@ int main() {
     int m = InputData::get_number_of_machines();
     std::vector<int> times = InputData::get_processing_times(n);
     InputData::MILPParameters milp_params = InputData::get_milp_parameters();
+    InputData::CapacityParameters capacity_params = InputData::get_capacity_parameters();
+    InputData::CoarseningParameters coarsening_params = InputData::get_coarsening_parameters();
     
     // ============================================
     // DISPLAY INPUT DATA
@@ -46,7 +93,9 @@ int main() {
     std::cout << "\n=== Solving with Both Algorithms ===" << std::endl;
     
     std::cout << "1. Running Pseudo-Polynomial Algorithm..." << std::endl;
-    PseudoPolynomialSolver pseudo_solver;
+    PseudoPolyOptions pseudo_options;
+    pseudo_options.certificate = true;
+    PseudoPolynomialSolver pseudo_solver(pseudo_options);
     PseudoPolySolution pseudo_solution = pseudo_solver.solve(times, m);
     
     if (pseudo_solution.isValid()) {
@@ -57,16 +106,211 @@ int main() {
         std::cout << "   ✗ Pseudo-polynomial failed: " << pseudo_solution.status << std::endl;
     }
     
+    // ============================================
+    // OPTIMALITY CERTIFICATE
+    // ============================================
+    CertificateCheck certificate = PartitionVerifier::verify(
+        times, m, pseudo_solution.split_points, pseudo_solution.witness);
+    if (certificate.optimal()) {
+        std::cout << "   ✓ Certificate verified: makespan " << certificate.makespan
+                  << " is optimal (" << certificate.verify_time << " seconds)" << std::endl;
+    } else {
+        std::cout << "   ✗ Certificate rejected: " << certificate.message << std::endl;
+    }
+    
+    // ============================================
+    // CAPACITY PLANNING (SAME PREFIX SUMS)
+    // ============================================
+    CapacityProfile capacity = pseudo_solver.capacityProfile(times,
+                                                             capacity_params.max_machines,
+                                                             capacity_params.target_makespan);
+    std::cout << "   Capacity curve for m = 1.." << capacity_params.max_machines
+              << " (" << capacity.feasibility_checks << " checks)" << std::endl;
+    std::cout << "   Machines for makespan <= " << capacity.target_makespan << ": "
+              << capacity.min_machines << std::endl;
+    
+    // ============================================
+    // HETEROGENEOUS MACHINE SPEEDS
+    // ============================================
+    std::vector<double> speeds = InputData::get_machine_speeds(m);
+    HeterogeneousPartitionSolver heterogeneous_solver;
+    PseudoPolySolution heterogeneous = heterogeneous_solver.solve(times, speeds);
+    if (heterogeneous.status == "optimal") {
+        std::cout << "   Wall-clock makespan on the mixed cluster: " << heterogeneous.makespan
+                  << " (" << heterogeneous.feasibility_checks << " checks)" << std::endl;
+    } else {
+        std::cout << "   ✗ Heterogeneous solve failed: " << heterogeneous.status << std::endl;
+    }
+    
+    // ============================================
+    // PIPELINE WITH COMMUNICATION COSTS
+    // ============================================
+    std::vector<int> comm = InputData::get_communication_costs(n);
+    PipelinePartitionSolver pipeline_solver;
+    PseudoPolySolution pipeline = pipeline_solver.solve(times, comm, m);
+    if (pipeline.status == "optimal") {
+        std::cout << "   Bottleneck stage with transfers: " << pipeline.makespan
+                  << " (" << pipeline.feasibility_checks << " checks)" << std::endl;
+    } else {
+        std::cout << "   ✗ Pipeline solve failed: " << pipeline.status << std::endl;
+    }
+    
+    // ============================================
+    // PER-JOB SLACK
+    // ============================================
+    SensitivityAnalyzer sensitivity_analyzer;
+    SensitivityReport sensitivity = sensitivity_analyzer.analyze(times, m);
+    if (sensitivity.status == "optimal") {
+        std::cout << "   Critical jobs (zero slack): " << sensitivity.critical_jobs << " in "
+                  << sensitivity.critical_ranges.size() / 2 << " runs" << std::endl;
+    } else {
+        std::cout << "   ✗ Sensitivity analysis failed: " << sensitivity.status << std::endl;
+    }
+    
+    // ============================================
+    // MACHINE LOSS (STABLE RE-OPTIMIZATION)
+    // ============================================
+    // One machine drops out; up to 1% above the new T* is traded for fewer
+    // migrated jobs
+    StableRepartition stable;
+    if (m > 1) {
+        int lost_machine = InputData::get_lost_machine(m);
+        std::vector<int> previous_split_points = pseudo_solution.split_points;
+        previous_split_points.resize(m + 1, n);
+        std::vector<int> survivors;
+        for (int k = 0; k < m; k++) {
+            if (k != lost_machine) survivors.push_back(k);
+        }
+        StablePartitionSolver stable_solver;
+        stable = stable_solver.solve(times, m - 1, previous_split_points, survivors,
+                                     static_cast<long long>(pseudo_solution.makespan) / 100);
+        if (stable.status == "optimal") {
+            std::cout << "   Without machine " << lost_machine << ": " << stable.jobs_moved
+                      << " jobs moved at makespan " << stable.makespan << " (plain re-solve: "
+                      << stable.resolve_jobs_moved << " at " << stable.optimal_makespan << ")" << std::endl;
+        } else {
+            std::cout << "   ✗ Stable re-optimization failed: " << stable.status << std::endl;
+        }
+    }
+    
+    // ============================================
+    // COARSENED CHAIN (ERROR BOUND)
+    // ============================================
+    // Chains within coarse_jobs are solved exactly, so there is nothing to show
+    if (n <= coarsening_params.coarse_jobs) {
+        std::cout << "   - Coarsening skipped: " << n << " jobs are within coarse_jobs = "
+                  << coarsening_params.coarse_jobs << std::endl;
+    } else {
+        CoarseningOptions coarse_options;
+        coarse_options.group_size = coarsening_params.group_size;
+        coarse_options.coarse_jobs = coarsening_params.coarse_jobs;
+        coarse_options.max_fine_probes = coarsening_params.max_fine_probes;
+        CoarsePartitionSolver coarse_solver(coarse_options);
+        CoarseSolution coarse = coarse_solver.solve(times, m);
+        if (coarse.status == "optimal" || coarse.status == "approximate") {
+            std::cout << "   " << coarse.coarse_jobs << " super-jobs over " << coarse.levels
+                      << " levels: makespan " << coarse.makespan << " within " << coarse.error_bound
+                      << " of optimal (bound " << coarse.max_super_job << ", " << coarse.fine_checks
+                      << " fine checks)" << std::endl;
+        } else {
+            std::cout << "   ✗ Coarsened solve failed: " << coarse.status << std::endl;
+        }
+    }
+    
+    // ============================================
+    // CIRCULAR CHAIN (ANY ROTATION)
+    // ============================================
+    CircularPartitionSolver circular_solver;
+    PseudoPolySolution circular = circular_solver.solve(times, m);
+    if (circular.status == "optimal") {
+        std::cout << "   Best rotation starts at job " << circular.split_points.front()
+                  << ": makespan " << circular.makespan << " (" << circular.feasibility_checks
+                  << " checks)" << std::endl;
+    } else {
+        std::cout << "   ✗ Circular solve failed: " << circular.status << std::endl;
+    }
+    
+    // ============================================
+    // NODES THEN CORES
+    // ============================================
+    // Crossing a node costs about one average job on each side
+    int cores_per_node = InputData::get_cores_per_node(m);
+    long long node_transfer_cost = 0;
+    for (int t : times) node_transfer_cost += t;
+    node_transfer_cost /= n;
+    HierarchicalPartitionSolver hierarchical_solver;
+    HierarchicalSolution hierarchical = hierarchical_solver.solve(
+        times, m / cores_per_node, cores_per_node, node_transfer_cost);
+    if (hierarchical.status == "optimal") {
+        std::cout << "   " << hierarchical.nodes << " nodes x " << cores_per_node
+                  << " cores, bottleneck core with transfers: " << hierarchical.makespan
+                  << " (" << hierarchical.feasibility_checks << " checks)" << std::endl;
+    } else {
+        std::cout << "   ✗ Hierarchical solve failed: " << hierarchical.status << std::endl;
+    }
+    
+    // ============================================
+    // CPU TIME AND MEMORY BANDWIDTH
+    // ============================================
+    std::vector<std::vector<int>> resources = {times, InputData::get_memory_bandwidth(n)};
+    MultiResourcePartitionSolver multi_resource_solver;
+    MultiResourceSolution multi_resource = multi_resource_solver.solve(
+        resources, m, InputData::get_resource_capacities());
+    if (multi_resource.status == "optimal") {
+        std::cout << "   Normalized bottleneck over time and bandwidth: " << multi_resource.makespan
+                  << " (resource " << multi_resource.bottleneck_resource << ", "
+                  << multi_resource.feasibility_checks << " checks)" << std::endl;
+    } else {
+        std::cout << "   ✗ Multi-resource solve failed: " << multi_resource.status << std::endl;
+    }
+    
+    // ============================================
+    // FREE JOB ORDER (NON-CONTIGUOUS BOUND)
+    // ============================================
+    HighMultiplicitySolver free_order_solver;
+    HighMultiplicitySolution free_order = free_order_solver.solve(times, m);
+    if (free_order.isValid()) {
+        std::cout << "   Makespan if jobs may be reordered: " << free_order.makespan
+                  << " (" << free_order.status << ", " << free_order.nodes << " nodes)" << std::endl;
+    } else {
+        std::cout << "   ✗ Free-order engine failed: " << free_order.status << std::endl;
+    }
+    
+    std::vector<OutputWriterJson::AlgorithmResult> free_order_results;
+    for (FreeOrderHeuristic heuristic : {FreeOrderHeuristic::LPT, FreeOrderHeuristic::Multifit,
+                                         FreeOrderHeuristic::KarmarkarKarp}) {
+        FreeOrderHeuristicSolver heuristic_solver(heuristic);
+        PseudoPolySolution schedule = heuristic_solver.solve(times, m);
+        std::string name = FreeOrderHeuristicSolver::name(heuristic);
+        std::cout << "   " << name << ": makespan " << schedule.makespan
+                  << ", gap " << (schedule.gap * 100) << "%" << std::endl;
+        free_order_results.push_back(
+            OutputWriterJson::JsonWriter::createFreeOrderResult(name, schedule));
+    }
+    
     // ============================================
     // SOLVE WITH MILP ALGORITHM
     // ============================================
     std::cout << "\n2. Running MILP Algorithm..." << std::endl;
-    MILPSolver milp_solver;
-    MILPSolution milp_solution = milp_solver.solve(times, m, 
-                                                   milp_params.time_limit, 
-                                                   milp_params.mip_gap);
+    MILPSolution milp_solution;
+    if (milp_params.skip_if_certified && certificate.optimal()) {
+        // The certificate already proves optimality; the MILP would only confirm it
+        milp_solution.status = "skipped_certified";
+        milp_solution.makespan = -1.0;
+        milp_solution.solve_time = 0.0;
+        milp_solution.gap = -1.0;
+        milp_solution.iterations = 0;
+        milp_solution.nodes = 0;
+    } else {
+        MILPSolver milp_solver;
+        milp_solution = milp_solver.solve(times, m,
+                                          milp_params.time_limit,
+                                          milp_params.mip_gap);
+    }
     
-    if (milp_solution.isValid()) {
+    if (milp_solution.status == "skipped_certified") {
+        std::cout << "   - MILP skipped: pseudo-polynomial optimum is certified" << std::endl;
+    } else if (milp_solution.isValid()) {
         std::cout << "   ✓ MILP solution found" << std::endl;
         std::cout << "   Makespan: " << milp_solution.makespan << std::endl;
         std::cout << "   Solve time: " << milp_solution.solve_time << " seconds" << std::endl;
@@ -85,6 +329,12 @@ int main() {
     
     auto test_result = OutputWriterJson::JsonWriter::createTestResult(
         test_name, n, m, times, -1.0, pseudo_solution, milp_solution);
+    test_result.capacity_profile = capacity;
+    test_result.free_order_results = free_order_results;
+    test_result.hierarchical = hierarchical;
+    test_result.sensitivity = sensitivity;
+    OutputWriterJson::JsonWriter::attachCertificate(test_result, certificate);
+    test_result.stable = stable;
     
     // ============================================
     // CREATE RESULTS DIRECTORY
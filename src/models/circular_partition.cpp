@@ -0,0 +1,174 @@
+#include "models/circular_partition.hpp"
+#include "models/prefix_partition.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+PseudoPolySolution CircularPartitionSolver::solve(const std::vector<int>& times, int m,
+                                                  bool is_test_mode) {
+    PseudoPolySolution result;
+    result.feasibility_checks = 0;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        result.solve_time = 0.0;
+        std::cerr << "Circular input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    try {
+        const int n = static_cast<int>(times.size());
+
+        PseudoPolySolution linear = linear_solver_.solve(times, m, true);
+        if (linear.status != "optimal") {
+            throw runtime_error("Linear solve failed: " + linear.status);
+        }
+        result.feasibility_checks += linear.feasibility_checks;
+
+        PrefixPartition::buildPrefixSums(times, prefix_);
+        const long long total = prefix_.back();
+        const long long lower = max<long long>(*max_element(times.begin(), times.end()),
+                                               (total + m - 1) / m);
+        long long best = static_cast<long long>(linear.makespan);
+        int best_start = 0;
+
+        if (best > lower) {
+            // Shortest window [a + 1, end] of a greedy arc [a, end) from job 0 at
+            // best - 1 that stopped before its next job
+            int window_first = 0;
+            int window_last = -1;
+            for (int position = 0; position < n;) {
+                int end = reach(position, best - 1, n, position);
+                if (end < n && (window_last < 0 || end - position - 1 < window_last - window_first)) {
+                    window_first = position + 1;
+                    window_last = end;
+                }
+                position = end;
+            }
+
+            // One sweep over the window; the boundaries only move forward while
+            // best stays the same
+            result.feasibility_checks++;
+            boundaries_.assign(m, 0);
+            for (int first = window_first; first <= window_last && best > lower; first++) {
+                int start = first % n;
+                if (sweepStart(start, best - 1, m)) {
+                    best = solveRotation(start, lower, best - 1, m, result.feasibility_checks);
+                    best_start = start;
+                }
+            }
+        }
+
+        arcs(best_start, best, result.split_points, result.machine_loads);
+        result.makespan = static_cast<double>(best);
+        result.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        std::cerr << "Circular input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.makespan = -1.0;
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+long long CircularPartitionSolver::unrolled(int position) const {
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    return position <= n ? prefix_[position] : prefix_[n] + prefix_[position - n];
+}
+
+int CircularPartitionSolver::reach(int position, long long T, int limit, int hint) const {
+    // Largest end in [position, limit] with load at most T. A feasible hint is a
+    // lower bound on it, so the search gallops up from there.
+    const long long base = unrolled(position);
+    int low = min(max(hint, position), limit);
+    if (unrolled(low) - base > T) low = position;
+    int step = 1;
+    int high = low + step;
+    while (high <= limit && unrolled(high) - base <= T) {
+        low = high;
+        step *= 2;
+        high = low + step;
+    }
+    high = min(high, limit + 1);
+    // Invariant: low fits, high does not (or lies past the limit)
+    while (high - low > 1) {
+        int middle = low + (high - low) / 2;
+        if (unrolled(middle) - base <= T) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+bool CircularPartitionSolver::sweepStart(int start, long long T, int m) {
+    // Greedy arcs from a later start end no earlier, so the previous start's
+    // boundaries seed the jumps
+    const int limit = start + static_cast<int>(prefix_.size()) - 1;
+    int position = start;
+    for (int k = 0; k < m; k++) {
+        int end = reach(position, T, limit, boundaries_[k]);
+        boundaries_[k] = end;
+        if (end == limit) return true;
+        if (end == position) return false;
+        position = end;
+    }
+    return false;
+}
+
+long long CircularPartitionSolver::solveRotation(int start, long long left, long long right, int m,
+                                                 int& checks) const {
+    // Parametric search on one rotation: right is feasible, and each probe snaps
+    // to the largest arc (feasible) or the smallest arc plus its next job
+    const int limit = start + static_cast<int>(prefix_.size()) - 1;
+    while (left < right) {
+        long long middle = left + (right - left) / 2;
+        long long largest = 0;
+        long long grown = LLONG_MAX;
+        int position = start;
+        for (int k = 0; k < m && position < limit; k++) {
+            int end = reach(position, middle, limit, position);
+            largest = max(largest, unrolled(end) - unrolled(position));
+            if (end < limit) grown = min(grown, unrolled(end + 1) - unrolled(position));
+            position = end;
+        }
+        checks++;
+        if (position == limit) {
+            right = largest;
+        } else {
+            left = grown;
+        }
+    }
+    return right;
+}
+
+void CircularPartitionSolver::arcs(int start, long long T, std::vector<int>& split_points,
+                                   std::vector<long long>& loads) const {
+    const int limit = start + static_cast<int>(prefix_.size()) - 1;
+    split_points.assign(1, start);
+    loads.clear();
+    for (int position = start; position < limit;) {
+        int end = reach(position, T, limit, position);
+        if (end == position) {
+            throw runtime_error("Arcs at the optimal makespan do not cover the ring");
+        }
+        split_points.push_back(end);
+        loads.push_back(unrolled(end) - unrolled(position));
+        position = end;
+    }
+}
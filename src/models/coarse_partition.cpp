@@ -0,0 +1,211 @@
+#include "models/coarse_partition.hpp"
+#include "models/prefix_partition.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+CoarseSolution CoarsePartitionSolver::solve(const std::vector<int>& times, int m, bool is_test_mode) {
+    CoarseSolution result;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.status = "invalid_input";
+        std::cerr << "Coarsening input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    try {
+        if (options_.group_size < 2) {
+            throw invalid_argument("group_size must be at least 2 (" + to_string(options_.group_size) + ")");
+        }
+        const int n = static_cast<int>(times.size());
+        const long long group = options_.group_size;
+
+        // One pass over the fine times: the bounds and the level-1 super-jobs
+        long long total = 0;
+        long long max_time = 0;
+        std::vector<long long> next((n + group - 1) / group);
+        for (long long first = 0; first < n; first += group) {
+            const long long last = min<long long>(first + group, n);
+            long long sum = 0;
+            for (long long i = first; i < last; i++) {
+                sum += times[i];
+                max_time = max<long long>(max_time, times[i]);
+            }
+            next[first / group] = sum;
+            total += sum;
+        }
+
+        // Coarsen until a level is small enough, or the next one would leave
+        // m super-jobs or fewer, or outgrow int
+        levels_.clear();
+        while (entries(times, static_cast<int>(levels_.size())) > options_.coarse_jobs) {
+            if (!levels_.empty()) {
+                const std::vector<long long>& below = levels_.back();
+                next.assign((below.size() + group - 1) / group, 0);
+                for (size_t i = 0; i < below.size(); i++) {
+                    next[i / group] += below[i];
+                }
+            }
+            if (static_cast<long long>(next.size()) <= m ||
+                *max_element(next.begin(), next.end()) > INT_MAX) {
+                break;
+            }
+            levels_.push_back(std::move(next));
+            next = std::vector<long long>();
+        }
+        const int top = static_cast<int>(levels_.size());
+        result.levels = top;
+
+        if (top == 0) {
+            top_times_ = times;
+        } else {
+            top_times_.assign(levels_.back().begin(), levels_.back().end());
+        }
+        PrefixPartition::buildPrefixSums(top_times_, top_prefix_);
+        result.coarse_jobs = static_cast<int>(top_times_.size());
+        result.max_super_job = *max_element(top_times_.begin(), top_times_.end());
+
+        PseudoPolySolution coarse = coarse_solver_.solve(top_times_, m, true);
+        if (coarse.status != "optimal") {
+            throw runtime_error("Coarse solve failed: " + coarse.status);
+        }
+        result.coarse_checks = coarse.feasibility_checks;
+
+        // Coarse blocks are fine blocks, and rounding fine boundaries up to
+        // super-job edges costs at most one super-job per block
+        long long upper = static_cast<long long>(coarse.makespan);
+        long long lower = max(max_time, (total + m - 1) / m);
+        lower = max(lower, top == 0 ? upper : upper - result.max_super_job);
+
+        while (lower < upper &&
+               (options_.max_fine_probes < 0 || result.fine_checks < options_.max_fine_probes)) {
+            long long middle = lower + (upper - lower) / 2;
+            long long candidate = 0;
+            result.fine_checks++;
+            if (probe(times, middle, m, candidate)) {
+                upper = candidate;
+            } else {
+                lower = candidate;
+            }
+        }
+
+        result.split_points.assign(1, 0);
+        result.machine_loads.clear();
+        for (int position = 0; position < n;) {
+            long long load = 0;
+            int end = jump(times, position, upper, load);
+            if (end == position) {
+                throw runtime_error("Blocks at makespan " + to_string(upper) + " do not cover the chain");
+            }
+            result.split_points.push_back(end);
+            result.machine_loads.push_back(load);
+            position = end;
+        }
+        result.makespan = *max_element(result.machine_loads.begin(), result.machine_loads.end());
+        result.lower_bound = lower;
+        result.error_bound = result.makespan - lower;
+        result.status = (result.error_bound == 0) ? "optimal" : "approximate";
+
+    } catch (const invalid_argument& e) {
+        result.status = "invalid_input";
+        std::cerr << "Coarsening input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+long long CoarsePartitionSolver::entry(const std::vector<int>& times, int level, long long index) const {
+    return level == 0 ? times[index] : levels_[level - 1][index];
+}
+
+long long CoarsePartitionSolver::entries(const std::vector<int>& times, int level) const {
+    return level == 0 ? static_cast<long long>(times.size())
+                      : static_cast<long long>(levels_[level - 1].size());
+}
+
+int CoarsePartitionSolver::jump(const std::vector<int>& times, int start, long long T,
+                                long long& load) const {
+    // Largest end with load [start, end) <= T. Climb while the entries up to the
+    // next group edge fit, jump over whole top super-jobs by binary search, then
+    // descend into the first entry that overflows.
+    const long long group = options_.group_size;
+    const int top = static_cast<int>(levels_.size());
+    long long remaining = T;
+    long long index = start;
+    int level = 0;
+    bool overflow = false;
+    while (level < top && !overflow) {
+        const long long size = entries(times, level);
+        while (index < size && index % group != 0) {
+            long long value = entry(times, level, index);
+            if (value > remaining) {
+                overflow = true;
+                break;
+            }
+            remaining -= value;
+            index++;
+        }
+        if (index == size) {
+            load = T - remaining;
+            return static_cast<int>(times.size());
+        }
+        if (!overflow) {
+            index /= group;
+            level++;
+        }
+    }
+    if (!overflow) {
+        long long reach = top_prefix_[index] + remaining;
+        long long last = upper_bound(top_prefix_.begin() + index, top_prefix_.end(), reach) -
+                         top_prefix_.begin() - 1;
+        remaining -= top_prefix_[last] - top_prefix_[index];
+        index = last;
+        if (index == static_cast<long long>(top_times_.size())) {
+            load = T - remaining;
+            return static_cast<int>(times.size());
+        }
+    }
+    // The entry at (level, index) overflows, and so does one of its children
+    while (level > 0) {
+        level--;
+        index *= group;
+        for (long long value = entry(times, level, index); value <= remaining;
+             value = entry(times, level, index)) {
+            remaining -= value;
+            index++;
+        }
+    }
+    load = T - remaining;
+    return static_cast<int>(index);
+}
+
+bool CoarsePartitionSolver::probe(const std::vector<int>& times, long long T, int m,
+                                  long long& candidate) const {
+    // Greedy at T: the largest block if it covers the chain, otherwise the
+    // smallest block plus its next job
+    const int n = static_cast<int>(times.size());
+    long long largest = 0;
+    long long grown = LLONG_MAX;
+    int position = 0;
+    for (int k = 0; k < m && position < n; k++) {
+        long long load = 0;
+        int end = jump(times, position, T, load);
+        largest = max(largest, load);
+        if (end < n) grown = min(grown, load + times[end]);
+        if (end == position) break;
+        position = end;
+    }
+    candidate = (position == n) ? largest : grown;
+    return position == n;
+}
@@ -0,0 +1,99 @@
+#include "models/dp_solver.hpp"
+#include "models/prefix_partition.hpp"
+#include <chrono>
+#include <algorithm>
+#include <climits>
+#include <iostream>
+
+using namespace std;
+using namespace std::chrono;
+
+PseudoPolySolution DPSolver::solve(const std::vector<int>& times, int m, bool is_test_mode) {
+    PseudoPolySolution result;
+    auto start_time = high_resolution_clock::now();
+    
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.status = "invalid_input";
+        result.solve_time = 0.0;
+        std::cerr << "DP input error: " << error_msg << std::endl;
+        return result;
+    }
+    
+    // The DP has no feasibility probes
+    result.feasibility_checks = 0;
+    
+    try {
+        const int n = static_cast<int>(times.size());
+        PrefixPartition::buildPrefixSums(times, prefix_);
+        
+        // Layer 1: a single block holding jobs [0, j)
+        previous_.assign(n + 1, LLONG_MAX);
+        current_.assign(n + 1, LLONG_MAX);
+        split_.assign(m + 1, vector<int>(n + 1, 0));
+        for (int j = 1; j <= n; j++) {
+            previous_[j] = combine(0, 0, j);
+        }
+        
+        // Layer k needs j >= k jobs, and its last block starts at i in [k-1, j-1]
+        for (int k = 2; k <= m; k++) {
+            fill(current_.begin(), current_.end(), LLONG_MAX);
+            fillLayer(k, k, n, k - 1, n - 1);
+            previous_.swap(current_);
+        }
+        
+        // Walk the split points back from the full chain
+        result.split_points.assign(m + 1, 0);
+        result.split_points[m] = n;
+        for (int k = m; k >= 2; k--) {
+            result.split_points[k - 1] = split_[k][result.split_points[k]];
+        }
+        
+        result.machine_loads = PrefixPartition::blockLoads(prefix_, result.split_points);
+        result.makespan = *max_element(result.machine_loads.begin(), result.machine_loads.end());
+        
+        auto end_time = high_resolution_clock::now();
+        result.solve_time = duration<double>(end_time - start_time).count();
+        result.status = "optimal";
+        
+    } catch (const exception& e) {
+        result.status = string("error: ") + e.what();
+        auto end_time = high_resolution_clock::now();
+        result.solve_time = duration<double>(end_time - start_time).count();
+    }
+    
+    return result;
+}
+
+long long DPSolver::combine(long long before, int i, int j) const {
+    long long load = prefix_[j] - prefix_[i];
+    if (objective_ == PartitionObjective::SumOfSquares) {
+        return before + load * load;
+    }
+    return max(before, load);
+}
+
+void DPSolver::fillLayer(int k, int j_lo, int j_hi, int i_lo, int i_hi) {
+    if (j_lo > j_hi) return;
+    
+    // Best split for the middle column, then recurse on both halves with the
+    // split range cut at that point
+    int j = j_lo + (j_hi - j_lo) / 2;
+    int best_i = i_lo;
+    long long best = LLONG_MAX;
+    
+    for (int i = i_lo; i <= min(i_hi, j - 1); i++) {
+        if (previous_[i] == LLONG_MAX) continue;
+        long long value = combine(previous_[i], i, j);
+        if (value < best) {
+            best = value;
+            best_i = i;
+        }
+    }
+    
+    current_[j] = best;
+    split_[k][j] = best_i;
+    
+    fillLayer(k, j_lo, j - 1, i_lo, best_i);
+    fillLayer(k, j + 1, j_hi, best_i, i_hi);
+}
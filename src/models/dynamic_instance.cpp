@@ -0,0 +1,276 @@
+#include "models/dynamic_instance.hpp"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+DynamicInstance::DynamicInstance(const std::vector<int>& times, int m)
+    : m_(m), rng_(20240611u) {
+    if (m < 1) {
+        throw invalid_argument("m must be positive (m=" + to_string(m) + ")");
+    }
+    
+    nodes_.reserve(times.size() + 1);
+    nodes_.push_back({0, 0, 0, 0, 0, 0, 0});
+    for (int t : times) {
+        if (t < 1) {
+            throw invalid_argument("Processing times must be positive (t=" + to_string(t) + ")");
+        }
+        root_ = merge(root_, newNode(t));
+    }
+    
+    resolve(0, LLONG_MAX);
+}
+
+void DynamicInstance::insertJob(int position, int time) {
+    if (position < 0 || position > size()) {
+        throw out_of_range("Insert position " + to_string(position) + " out of range");
+    }
+    if (time < 1) {
+        throw invalid_argument("Processing times must be positive (t=" + to_string(time) + ")");
+    }
+    
+    int left, right;
+    split(root_, position, left, right);
+    root_ = merge(merge(left, newNode(time)), right);
+    
+    // A new job never helps and fits into some block on top of the old optimum
+    resolve(makespan_, makespan_ + time);
+}
+
+void DynamicInstance::eraseJob(int position) {
+    if (position < 0 || position >= size()) {
+        throw out_of_range("Erase position " + to_string(position) + " out of range");
+    }
+    
+    int left, middle, right;
+    split(root_, position, left, right);
+    split(right, 1, middle, right);
+    int time = nodes_[middle].time;
+    free_nodes_.push_back(middle);
+    root_ = merge(left, right);
+    
+    resolve(makespan_ - time, makespan_);
+}
+
+void DynamicInstance::updateJob(int position, int time) {
+    if (position < 0 || position >= size()) {
+        throw out_of_range("Update position " + to_string(position) + " out of range");
+    }
+    if (time < 1) {
+        throw invalid_argument("Processing times must be positive (t=" + to_string(time) + ")");
+    }
+    
+    long long before = nodes_[root_].sum;
+    assign(root_, position, time);
+    long long delta = nodes_[root_].sum - before;
+    
+    if (delta >= 0) {
+        resolve(makespan_, makespan_ + delta);
+    } else {
+        resolve(makespan_ + delta, makespan_);
+    }
+}
+
+int DynamicInstance::size() const {
+    return nodes_[root_].size;
+}
+
+PseudoPolySolution DynamicInstance::toSolution() const {
+    PseudoPolySolution result;
+    vector<int> times;
+    times.reserve(size());
+    collect(root_, times);
+    
+    result.split_points = split_points_;
+    for (size_t k = 0; k + 1 < split_points_.size(); k++) {
+        long long load = 0;
+        for (int job = split_points_[k]; job < split_points_[k + 1]; job++) {
+            load += times[job];
+        }
+        result.machine_loads.push_back(load);
+    }
+    
+    result.makespan = static_cast<double>(makespan_);
+    result.solve_time = 0.0;
+    result.feasibility_checks = last_checks_;
+    result.status = "optimal";
+    return result;
+}
+
+// ============================================
+// TREAP MAINTENANCE
+// ============================================
+
+int DynamicInstance::newNode(int time) {
+    Node node = {time, static_cast<unsigned>(rng_()), 0, 0, 1, time, time};
+    if (!free_nodes_.empty()) {
+        int v = free_nodes_.back();
+        free_nodes_.pop_back();
+        nodes_[v] = node;
+        return v;
+    }
+    nodes_.push_back(node);
+    return static_cast<int>(nodes_.size()) - 1;
+}
+
+void DynamicInstance::pull(int v) {
+    Node& node = nodes_[v];
+    const Node& l = nodes_[node.left];
+    const Node& r = nodes_[node.right];
+    node.size = l.size + 1 + r.size;
+    node.sum = l.sum + node.time + r.sum;
+    node.max_time = max(node.time, max(l.max_time, r.max_time));
+}
+
+void DynamicInstance::split(int v, int k, int& left, int& right) {
+    // left gets the first k jobs of subtree v, right the rest
+    if (v == 0) {
+        left = right = 0;
+        return;
+    }
+    if (nodes_[nodes_[v].left].size >= k) {
+        int inner;
+        split(nodes_[v].left, k, left, inner);
+        nodes_[v].left = inner;
+        right = v;
+    } else {
+        int inner;
+        split(nodes_[v].right, k - nodes_[nodes_[v].left].size - 1, inner, right);
+        nodes_[v].right = inner;
+        left = v;
+    }
+    pull(v);
+}
+
+int DynamicInstance::merge(int left, int right) {
+    if (left == 0) return right;
+    if (right == 0) return left;
+    if (nodes_[left].priority > nodes_[right].priority) {
+        int merged = merge(nodes_[left].right, right);
+        nodes_[left].right = merged;
+        pull(left);
+        return left;
+    }
+    int merged = merge(left, nodes_[right].left);
+    nodes_[right].left = merged;
+    pull(right);
+    return right;
+}
+
+void DynamicInstance::assign(int v, int k, int time) {
+    int left_size = nodes_[nodes_[v].left].size;
+    if (k < left_size) {
+        assign(nodes_[v].left, k, time);
+    } else if (k > left_size) {
+        assign(nodes_[v].right, k - left_size - 1, time);
+    } else {
+        nodes_[v].time = time;
+    }
+    pull(v);
+}
+
+void DynamicInstance::collect(int v, std::vector<int>& times) const {
+    if (v == 0) return;
+    collect(nodes_[v].left, times);
+    times.push_back(nodes_[v].time);
+    collect(nodes_[v].right, times);
+}
+
+// ============================================
+// OPTIMAL MAKESPAN SEARCH
+// ============================================
+
+DynamicInstance::Prefix DynamicInstance::prefixAtMost(long long limit) const {
+    // Times are positive, so prefix sums increase along the in-order walk
+    Prefix result = {0, 0, 0};
+    int v = root_;
+    while (v != 0) {
+        const Node& node = nodes_[v];
+        const Node& l = nodes_[node.left];
+        if (l.sum > limit) {
+            v = node.left;
+        } else if (l.sum + node.time > limit) {
+            result.count += l.size;
+            result.sum += l.sum;
+            result.next_time = node.time;
+            break;
+        } else {
+            result.count += l.size + 1;
+            result.sum += l.sum + node.time;
+            limit -= l.sum + node.time;
+            v = node.right;
+        }
+    }
+    return result;
+}
+
+bool DynamicInstance::probe(long long T, long long& candidate) const {
+    // Same contract as PrefixPartition::probeCandidate, one treap descent per block
+    const int n = size();
+    int pos = 0;
+    long long start_sum = 0;
+    long long max_load = 0;
+    long long next_candidate = LLONG_MAX;
+    
+    for (int block = 0; block < m_; block++) {
+        Prefix end = prefixAtMost(start_sum + T);
+        long long load = end.sum - start_sum;
+        
+        if (end.count == n) {
+            candidate = max(max_load, load);
+            return true;
+        }
+        
+        next_candidate = min(next_candidate, load + end.next_time);
+        if (end.count == pos) break;  // Job `pos` is longer than T
+        max_load = max(max_load, load);
+        pos = end.count;
+        start_sum = end.sum;
+    }
+    
+    candidate = next_candidate;
+    return false;
+}
+
+void DynamicInstance::resolve(long long lower, long long upper) {
+    const int n = size();
+    const long long total = nodes_[root_].sum;
+    last_checks_ = 0;
+    split_points_.assign(1, 0);
+    
+    if (n == 0) {
+        makespan_ = 0;
+        return;
+    }
+    
+    // Standard bounds, the upper one always feasible
+    long long average = (total + m_ - 1) / m_;
+    long long max_time = nodes_[root_].max_time;
+    long long left = max(lower, max(max_time, average));
+    long long right = min(upper, min(total, average + max_time));
+    left = min(left, right);
+    
+    while (left < right) {
+        long long mid = left + (right - left) / 2;
+        long long candidate;
+        last_checks_++;
+        
+        if (probe(mid, candidate)) {
+            right = candidate;
+        } else {
+            left = candidate;
+        }
+    }
+    makespan_ = left;
+    
+    // Split points of the greedy for T*
+    long long start_sum = 0;
+    while (split_points_.back() < n) {
+        Prefix end = prefixAtMost(start_sum + makespan_);
+        split_points_.push_back(end.count);
+        start_sum = end.sum;
+    }
+}
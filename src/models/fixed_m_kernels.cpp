@@ -0,0 +1,89 @@
+#include "models/fixed_m_kernels.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+
+using namespace std;
+
+namespace FixedMKernels {
+
+    namespace {
+
+        // Largest j with prefix[j] - prefix[start] <= T (see PrefixPartition::nextBoundary)
+        template <typename AccT>
+        inline int nextBoundary(const AccT* prefix, int n, int start, AccT T) {
+            return static_cast<int>(upper_bound(prefix + start + 1, prefix + n + 1, prefix[start] + T) -
+                                    prefix) - 1;
+        }
+
+        template <int M, typename AccT>
+        bool probeFixed(const AccT* prefix, int n, AccT T, AccT& candidate) {
+            int pos = 0;
+            AccT max_load = 0;
+            AccT next_candidate = numeric_limits<AccT>::max();
+            
+#pragma GCC unroll 16
+            for (int block = 0; block < M; block++) {
+                int next = nextBoundary(prefix, n, pos, T);
+                AccT load = prefix[next] - prefix[pos];
+                
+                if (next == n) {
+                    candidate = max(max_load, load);
+                    return true;
+                }
+                
+                next_candidate = min<AccT>(next_candidate, load + prefix[next + 1] - prefix[next]);
+                if (next == pos) break;  // Job `pos` is longer than T
+                max_load = max(max_load, load);
+                pos = next;
+            }
+            
+            candidate = next_candidate;
+            return false;
+        }
+
+        template <int M, typename AccT>
+        int splitPointsFixed(const AccT* prefix, int n, AccT T, int* split_points) {
+            int count = 1;
+            split_points[0] = 0;
+            
+#pragma GCC unroll 16
+            for (int block = 0; block < M; block++) {
+                int start = split_points[count - 1];
+                if (start == n) break;
+                split_points[count++] = max(nextBoundary(prefix, n, start, T), start + 1);
+            }
+            return count;
+        }
+
+        // Entry m holds the kernel for m machines; entry 0 is unused
+        template <typename AccT, size_t... M>
+        constexpr array<ProbeFn<AccT>, sizeof...(M)> probeTable(index_sequence<M...>) {
+            return {{(M == 0 ? nullptr : &probeFixed<static_cast<int>(M == 0 ? 1 : M), AccT>)...}};
+        }
+
+        template <typename AccT, size_t... M>
+        constexpr array<SplitFn<AccT>, sizeof...(M)> splitTable(index_sequence<M...>) {
+            return {{(M == 0 ? nullptr : &splitPointsFixed<static_cast<int>(M == 0 ? 1 : M), AccT>)...}};
+        }
+
+    }
+    
+    template <typename AccT>
+    ProbeFn<AccT> probeFor(int m) {
+        static constexpr auto table = probeTable<AccT>(make_index_sequence<kMaxMachines + 1>());
+        return (m >= 1 && m <= kMaxMachines) ? table[m] : nullptr;
+    }
+    
+    template <typename AccT>
+    SplitFn<AccT> splitPointsFor(int m) {
+        static constexpr auto table = splitTable<AccT>(make_index_sequence<kMaxMachines + 1>());
+        return (m >= 1 && m <= kMaxMachines) ? table[m] : nullptr;
+    }
+    
+    template ProbeFn<uint32_t> probeFor<uint32_t>(int);
+    template ProbeFn<uint64_t> probeFor<uint64_t>(int);
+    template SplitFn<uint32_t> splitPointsFor<uint32_t>(int);
+    template SplitFn<uint64_t> splitPointsFor<uint64_t>(int);
+}
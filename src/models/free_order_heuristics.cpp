@@ -0,0 +1,329 @@
+#include "models/free_order_heuristics.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <queue>
+#include <set>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+std::string FreeOrderHeuristicSolver::name(FreeOrderHeuristic heuristic) {
+    switch (heuristic) {
+        case FreeOrderHeuristic::LPT: return "lpt";
+        case FreeOrderHeuristic::Multifit: return "multifit";
+        case FreeOrderHeuristic::KarmarkarKarp: return "karmarkar_karp";
+    }
+    return "unknown";
+}
+
+long long FreeOrderHeuristicSolver::lowerBound(const std::vector<int>& times, int m) {
+    long long total = accumulate(times.begin(), times.end(), 0LL);
+    long long longest = times.empty() ? 0 : *max_element(times.begin(), times.end());
+    return max(longest, (total + m - 1) / m);
+}
+
+PseudoPolySolution FreeOrderHeuristicSolver::solve(const std::vector<int>& times, int m,
+                                                   bool is_test_mode) {
+    PseudoPolySolution result;
+    result.feasibility_checks = 0;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        result.solve_time = 0.0;
+        std::cerr << name(heuristic_) << " input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    try {
+        const long long lower = lowerBound(times, m);
+
+        vector<int> machine(times.size(), 0);
+        switch (heuristic_) {
+            case FreeOrderHeuristic::LPT: assignLPT(times, m, machine); break;
+            case FreeOrderHeuristic::Multifit: assignMultifit(times, m, lower, machine); break;
+            case FreeOrderHeuristic::KarmarkarKarp: assignKarmarkarKarp(times, m, machine); break;
+        }
+        if (options_.polish) {
+            vector<long long> loads(m, 0);
+            for (size_t job = 0; job < times.size(); job++) loads[machine[job]] += times[job];
+            if (*max_element(loads.begin(), loads.end()) > lower) polish(times, m, machine);
+        }
+
+        // Group the jobs machine by machine; empty machines get no block
+        vector<int> per_machine(m, 0);
+        for (int k : machine) per_machine[k]++;
+        vector<int> offset(m + 1, 0);
+        for (int k = 0; k < m; k++) offset[k + 1] = offset[k] + per_machine[k];
+
+        result.job_order.resize(times.size());
+        vector<int> cursor(offset.begin(), offset.end() - 1);
+        for (size_t job = 0; job < times.size(); job++) {
+            result.job_order[cursor[machine[job]]++] = static_cast<int>(job);
+        }
+
+        result.split_points.assign(1, 0);
+        result.machine_loads.clear();
+        for (int k = 0; k < m; k++) {
+            if (per_machine[k] == 0) continue;
+            long long load = 0;
+            for (int i = offset[k]; i < offset[k + 1]; i++) load += times[result.job_order[i]];
+            result.split_points.push_back(offset[k + 1]);
+            result.machine_loads.push_back(load);
+        }
+
+        long long makespan = *max_element(result.machine_loads.begin(), result.machine_loads.end());
+        result.makespan = static_cast<double>(makespan);
+        result.gap = static_cast<double>(makespan - lower) / lower;
+        result.status = (makespan == lower) ? "optimal" : "heuristic";
+
+    } catch (const invalid_argument& e) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        std::cerr << name(heuristic_) << " input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.makespan = -1.0;
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+std::vector<int> FreeOrderHeuristicSolver::byDecreasingTime(const std::vector<int>& times) const {
+    vector<int> order(times.size());
+    const int longest = *max_element(times.begin(), times.end());
+
+    // Counting sort for the usual short times, comparison sort otherwise
+    if (static_cast<size_t>(longest) > times.size()) {
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(),
+                    [&](int a, int b) { return times[a] > times[b]; });
+        return order;
+    }
+    vector<int> start(longest + 2, 0);
+    for (int t : times) start[longest - t + 1]++;
+    partial_sum(start.begin(), start.end(), start.begin());
+    for (size_t job = 0; job < times.size(); job++) {
+        order[start[longest - times[job]]++] = static_cast<int>(job);
+    }
+    return order;
+}
+
+// ============================================
+// CONSTRUCTIONS
+// ============================================
+
+void FreeOrderHeuristicSolver::assignLPT(const std::vector<int>& times, int m,
+                                         std::vector<int>& machine) const {
+    // Min-heap of (load, machine)
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<>> loads;
+    for (int k = 0; k < m; k++) loads.push({0, k});
+
+    for (int job : byDecreasingTime(times)) {
+        auto [load, k] = loads.top();
+        loads.pop();
+        machine[job] = k;
+        loads.push({load + times[job], k});
+    }
+}
+
+void FreeOrderHeuristicSolver::assignMultifit(const std::vector<int>& times, int m, long long lower,
+                                              std::vector<int>& machine) const {
+    const vector<int> order = byDecreasingTime(times);
+    int leaves = 1;
+    while (leaves < m) leaves *= 2;
+    vector<long long> room(2 * leaves);
+    vector<int> attempt(times.size());
+
+    // First fit decreasing into m bins of the given capacity; the segment tree
+    // holds the largest free space below each node, so a fit is O(log m)
+    auto firstFitDecreasing = [&](long long capacity) {
+        fill(room.begin() + leaves, room.end(), -1);
+        fill(room.begin() + leaves, room.begin() + leaves + m, capacity);
+        for (int node = leaves - 1; node >= 1; node--) {
+            room[node] = max(room[2 * node], room[2 * node + 1]);
+        }
+        for (int job : order) {
+            if (room[1] < times[job]) return false;
+            int node = 1;
+            while (node < leaves) node = (room[2 * node] >= times[job]) ? 2 * node : 2 * node + 1;
+            attempt[job] = node - leaves;
+            room[node] -= times[job];
+            for (node /= 2; node >= 1; node /= 2) {
+                room[node] = max(room[2 * node], room[2 * node + 1]);
+            }
+        }
+        return true;
+    };
+
+    // FFD always fits at max(2 S / m, max t)
+    long long total = accumulate(times.begin(), times.end(), 0LL);
+    long long left = lower;
+    long long right = max(lower, (2 * total + m - 1) / m);
+    while (!firstFitDecreasing(right)) right *= 2;
+    machine = attempt;
+
+    for (int step = 0; step < options_.multifit_iterations && left < right; step++) {
+        long long middle = left + (right - left) / 2;
+        if (firstFitDecreasing(middle)) {
+            right = middle;
+            machine = attempt;
+        } else {
+            left = middle + 1;
+        }
+    }
+}
+
+void FreeOrderHeuristicSolver::assignKarmarkarKarp(const std::vector<int>& times, int m,
+                                                   std::vector<int>& machine) const {
+    // A partial schedule keeps only its non-empty machines, heaviest first; each
+    // machine's jobs form a linked list so two machines merge in O(1)
+    struct Group {
+        long long load;
+        int head;
+        int tail;
+    };
+    const int n = static_cast<int>(times.size());
+    vector<int> next(n, -1);
+    vector<vector<Group>> partial(n);
+    auto spread = [&](const vector<Group>& groups) {
+        long long lightest = (static_cast<int>(groups.size()) == m) ? groups.back().load : 0;
+        return groups.front().load - lightest;
+    };
+
+    priority_queue<pair<long long, int>> heap;  // (max - min load, partial schedule)
+    for (int job = 0; job < n; job++) {
+        partial[job].push_back(Group{times[job], job, job});
+        heap.push({times[job], job});
+    }
+
+    // Merge the two schedules with the largest spread, heaviest machine of one
+    // with the lightest of the other
+    while (heap.size() > 1) {
+        int a = heap.top().second;
+        heap.pop();
+        int b = heap.top().second;
+        heap.pop();
+        const vector<Group>& A = partial[a];
+        const vector<Group>& B = partial[b];
+        const int size_a = static_cast<int>(A.size());
+        const int size_b = static_cast<int>(B.size());
+
+        vector<Group> merged;
+        merged.reserve(min(m, size_a + size_b));
+        for (int i = 0; i < size_a; i++) {
+            Group group = A[i];
+            int j = m - 1 - i;  // B, padded with empty machines, in increasing load
+            if (j < size_b) {
+                next[group.tail] = B[j].head;
+                group.tail = B[j].tail;
+                group.load += B[j].load;
+            }
+            merged.push_back(group);
+        }
+        for (int i = max(size_a, m - size_b); i < m; i++) {
+            merged.push_back(B[m - 1 - i]);
+        }
+        sort(merged.begin(), merged.end(),
+             [](const Group& x, const Group& y) { return x.load > y.load; });
+
+        partial[a] = move(merged);
+        vector<Group>().swap(partial[b]);
+        heap.push({spread(partial[a]), a});
+    }
+
+    const vector<Group>& schedule = partial[heap.top().second];
+    for (size_t k = 0; k < schedule.size(); k++) {
+        for (int job = schedule[k].head; job >= 0; job = next[job]) machine[job] = static_cast<int>(k);
+    }
+}
+
+// ============================================
+// LOCAL SEARCH
+// ============================================
+
+void FreeOrderHeuristicSolver::polish(const std::vector<int>& times, int m,
+                                      std::vector<int>& machine) const {
+    // Jobs of each machine by time, and machines by load
+    vector<map<int, vector<int>>> jobs(m);
+    vector<long long> load(m, 0);
+    for (size_t job = 0; job < times.size(); job++) {
+        jobs[machine[job]][times[job]].push_back(static_cast<int>(job));
+        load[machine[job]] += times[job];
+    }
+    set<pair<long long, int>> by_load;
+    for (int k = 0; k < m; k++) by_load.insert({load[k], k});
+
+    auto transfer = [&](int job, int from, int to) {
+        auto it = jobs[from].find(times[job]);
+        it->second.pop_back();
+        if (it->second.empty()) jobs[from].erase(it);
+        jobs[to][times[job]].push_back(job);
+        machine[job] = to;
+    };
+    auto setLoad = [&](int k, long long value) {
+        by_load.erase({load[k], k});
+        load[k] = value;
+        by_load.insert({value, k});
+    };
+
+    const long long limit = options_.polish_moves < 0 ? static_cast<long long>(times.size())
+                                                      : options_.polish_moves;
+    for (long long moves = 0; moves < limit; moves++) {
+        const int heavy = by_load.rbegin()->second;
+        bool improved = false;
+
+        // Lightest machines first: they leave the most room for a move
+        for (auto it = by_load.begin(); it != by_load.end() && it->second != heavy; ++it) {
+            const int light = it->second;
+            const long long room = load[heavy] - load[light];
+            if (room <= 1) break;
+
+            // Shift delta = t_out - t_in in (0, room), as close to room / 2 as possible
+            int best_out = -1;
+            int best_in = -1;
+            long long best_score = room;
+            for (const auto& [t_out, out_jobs] : jobs[heavy]) {
+                if (t_out < room && abs(2 * t_out - room) < best_score) {
+                    best_score = abs(2 * t_out - room);
+                    best_out = out_jobs.back();
+                    best_in = -1;
+                }
+                auto near = jobs[light].lower_bound(static_cast<int>(t_out - room / 2));
+                for (int side = 0; side < 2; side++) {
+                    if (side == 1) {
+                        if (near == jobs[light].begin()) break;
+                        --near;
+                    } else if (near == jobs[light].end()) {
+                        continue;
+                    }
+                    long long delta = t_out - near->first;
+                    if (delta > 0 && delta < room && abs(2 * delta - room) < best_score) {
+                        best_score = abs(2 * delta - room);
+                        best_out = out_jobs.back();
+                        best_in = near->second.back();
+                    }
+                }
+            }
+            if (best_out < 0) continue;
+
+            long long delta = times[best_out] - (best_in >= 0 ? times[best_in] : 0);
+            transfer(best_out, heavy, light);
+            if (best_in >= 0) transfer(best_in, light, heavy);
+            setLoad(heavy, load[heavy] - delta);
+            setLoad(light, load[light] + delta);
+            improved = true;
+            break;
+        }
+        if (!improved) break;
+    }
+}
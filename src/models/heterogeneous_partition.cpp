@@ -0,0 +1,151 @@
+#include "models/heterogeneous_partition.hpp"
+#include "models/prefix_partition.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+PseudoPolySolution HeterogeneousPartitionSolver::solve(const std::vector<int>& times,
+                                                       const std::vector<double>& speeds,
+                                                       bool is_test_mode) {
+    PseudoPolySolution result;
+    result.feasibility_checks = 0;
+    auto start_time = high_resolution_clock::now();
+    const int m = static_cast<int>(speeds.size());
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        result.solve_time = 0.0;
+        std::cerr << "Heterogeneous input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    try {
+        // Speeds as integer units, reduced by their gcd
+        units_.resize(m);
+        long long common = 0;
+        for (int j = 0; j < m; j++) {
+            double units = speeds[j] * kSpeedResolution;
+            if (!(units >= 1.0) || !std::isfinite(units) || units > 1e12) {
+                throw invalid_argument("Speed of machine " + to_string(j) + " is " +
+                                       to_string(speeds[j]) + ", must be in [1e-6, 1e6]");
+            }
+            units_[j] = llround(units);
+            common = gcd(common, units_[j]);
+        }
+        for (long long& units : units_) units /= common;
+
+        PrefixPartition::buildPrefixSums(times, prefix_);
+        const long long total = prefix_.back();
+        const long long longest = *max_element(times.begin(), times.end());
+        const long long fastest = *max_element(units_.begin(), units_.end());
+        const long long all_units = accumulate(units_.begin(), units_.end(), 0LL);
+
+        // T* lies in [max(max t / u_max, S / sum u), S / u_max]; the upper end runs
+        // everything on the fastest machine. The lower end need not be a candidate.
+        Fraction left{longest, fastest};
+        if (less(left, Fraction{total, all_units})) left = Fraction{total, all_units};
+        Fraction right{total, fastest};
+
+        // Bisect between the bounds; every probe snaps one of them onto a candidate
+        // on the far side of the midpoint, so they meet at T*
+        Fraction candidate{0, 1};
+        if (probe(left.load, left.units, candidate)) {
+            right = candidate;
+        } else {
+            left = candidate;
+        }
+        result.feasibility_checks++;
+        while (less(left, right)) {
+            __int128 numerator = static_cast<__int128>(left.load) * right.units +
+                                 static_cast<__int128>(right.load) * left.units;
+            __int128 denominator = static_cast<__int128>(2) * left.units * right.units;
+            if (probe(numerator, denominator, candidate)) {
+                right = candidate;
+            } else {
+                left = candidate;
+            }
+            result.feasibility_checks++;
+        }
+
+        splitPoints(right, result.split_points);
+        result.machine_loads = PrefixPartition::blockLoads(prefix_, result.split_points);
+
+        // Wall-clock makespan: L / s with s = u * common / kSpeedResolution
+        result.makespan = static_cast<double>(right.load) * kSpeedResolution /
+                          (static_cast<double>(right.units) * common);
+        result.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        std::cerr << "Heterogeneous input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.makespan = -1.0;
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+bool HeterogeneousPartitionSolver::less(const Fraction& a, const Fraction& b) {
+    return static_cast<__int128>(a.load) * b.units < static_cast<__int128>(b.load) * a.units;
+}
+
+bool HeterogeneousPartitionSolver::probe(__int128 numerator, __int128 denominator,
+                                         Fraction& candidate) const {
+    // Every T with the same capacities floor(T u_j) yields the same blocks: if they
+    // cover the chain, the largest block time is feasible; if not, no machine can
+    // take its next job before the smallest (load + next job) / u_j
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    const long long total = prefix_.back();
+    int pos = 0;
+    Fraction slowest{0, 1};
+    Fraction next{-1, 1};
+
+    for (size_t j = 0; j < units_.size(); j++) {
+        __int128 capacity = numerator * units_[j] / denominator;
+        int end = PrefixPartition::nextBoundary(
+            prefix_, pos, static_cast<long long>(min<__int128>(capacity, total)));
+        long long load = prefix_[end] - prefix_[pos];
+        if (load > 0 && less(slowest, Fraction{load, units_[j]})) slowest = Fraction{load, units_[j]};
+
+        if (end == n) {
+            candidate = slowest;
+            return true;
+        }
+        Fraction grown{load + prefix_[end + 1] - prefix_[end], units_[j]};
+        if (next.load < 0 || less(grown, next)) next = grown;
+        pos = end;
+    }
+
+    candidate = next;
+    return false;
+}
+
+void HeterogeneousPartitionSolver::splitPoints(const Fraction& T, std::vector<int>& split_points) const {
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    const long long total = prefix_.back();
+    split_points.assign(1, 0);
+
+    // Greedy blocks at T*, with the machines left over kept idle at the end
+    int pos = 0;
+    for (size_t j = 0; j < units_.size(); j++) {
+        __int128 capacity = static_cast<__int128>(T.load) * units_[j] / T.units;
+        pos = PrefixPartition::nextBoundary(
+            prefix_, pos, static_cast<long long>(min<__int128>(capacity, total)));
+        split_points.push_back(pos);
+    }
+    if (split_points.back() != n) {
+        throw runtime_error("Greedy blocks at the optimal makespan do not cover the chain");
+    }
+}
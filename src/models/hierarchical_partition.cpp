@@ -0,0 +1,153 @@
+#include "models/hierarchical_partition.hpp"
+#include "models/prefix_partition.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+HierarchicalSolution HierarchicalPartitionSolver::solve(const std::vector<int>& times, int nodes,
+                                                        int cores_per_node,
+                                                        long long node_transfer_cost,
+                                                        bool is_test_mode) {
+    HierarchicalSolution result;
+    result.nodes = nodes;
+    result.cores_per_node = cores_per_node;
+    result.node_transfer_cost = node_transfer_cost;
+    auto start_time = high_resolution_clock::now();
+
+    if (nodes < 1 || cores_per_node < 1 ||
+        static_cast<long long>(nodes) * cores_per_node > INT_MAX) {
+        result.status = "invalid_input";
+        std::cerr << "Hierarchical input error: nodes and cores per node must be positive (nodes="
+                  << nodes << ", cores=" << cores_per_node << ")" << std::endl;
+        return result;
+    }
+    const int m = nodes * cores_per_node;
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.status = "invalid_input";
+        std::cerr << "Hierarchical input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    try {
+        if (node_transfer_cost < 0) {
+            throw invalid_argument("Node transfer cost is " + to_string(node_transfer_cost) +
+                                   ", must be non-negative");
+        }
+
+        // Transfers only add load, so the flat optimum is a lower bound; its
+        // blocks grouped by node pay at most two transfers per core
+        PseudoPolySolution flat = flat_solver_.solve(times, m, true);
+        if (flat.status != "optimal") {
+            throw runtime_error("Flat solve failed: " + flat.status);
+        }
+        result.feasibility_checks += flat.feasibility_checks;
+        PrefixPartition::buildPrefixSums(times, prefix_);
+
+        long long left = static_cast<long long>(flat.makespan);
+        long long right = left + 2 * node_transfer_cost;
+        while (left < right) {
+            long long middle = left + (right - left) / 2;
+            result.feasibility_checks++;
+            if (probe(middle, nodes, cores_per_node, node_transfer_cost, nullptr)) {
+                right = middle;
+            } else {
+                left = middle + 1;
+            }
+        }
+
+        if (!probe(right, nodes, cores_per_node, node_transfer_cost, &result)) {
+            throw runtime_error("Greedy nodes at the optimal makespan do not cover the chain");
+        }
+        long long largest = 0;
+        for (const std::vector<long long>& loads : result.core_loads) {
+            largest = max(largest, *max_element(loads.begin(), loads.end()));
+        }
+        result.makespan = static_cast<double>(largest);
+        result.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        std::cerr << "Hierarchical input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.makespan = -1.0;
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+int HierarchicalPartitionSolver::fillNode(int start, long long T, int cores, long long in_cost,
+                                          long long out_cost, std::vector<int>* core_ends) const {
+    // Greedy cores with the first and last capacities reduced by their transfers;
+    // -1 when a transfer alone exceeds T
+    int position = start;
+    for (int core = 0; core < cores; core++) {
+        long long capacity = T - (core == 0 ? in_cost : 0) - (core == cores - 1 ? out_cost : 0);
+        if (capacity < 0) return -1;
+        position = PrefixPartition::nextBoundary(prefix_, position, capacity);
+        if (core_ends) core_ends->push_back(position);
+    }
+    return position;
+}
+
+bool HierarchicalPartitionSolver::probe(long long T, int nodes, int cores, long long cost,
+                                        HierarchicalSolution* solution) const {
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    std::vector<int> core_ends;
+    std::vector<int>* record = solution ? &core_ends : nullptr;
+    if (solution) {
+        solution->node_split_points.assign(1, 0);
+        solution->core_split_points.clear();
+        solution->core_loads.clear();
+    }
+
+    int position = 0;
+    for (int node = 0; node < nodes && position < n; node++) {
+        long long in_cost = position > 0 ? cost : 0;
+        core_ends.clear();
+
+        // A node that can finish the chain pays no outgoing transfer
+        int end = fillNode(position, T, cores, in_cost, 0, record);
+        if (end < n) {
+            core_ends.clear();
+            end = fillNode(position, T, cores, in_cost, cost, record);
+            if (end <= position) return false;
+        }
+
+        if (solution) {
+            long long out_cost = end < n ? cost : 0;
+            std::vector<int> splits(1, position);
+            std::vector<long long> loads;
+            for (int core = 0; core < cores; core++) {
+                splits.push_back(core_ends[core]);
+                loads.push_back(prefix_[splits[core + 1]] - prefix_[splits[core]] +
+                                (core == 0 ? in_cost : 0) + (core == cores - 1 ? out_cost : 0));
+            }
+            solution->node_split_points.push_back(end);
+            solution->core_split_points.push_back(splits);
+            solution->core_loads.push_back(loads);
+        }
+        position = end;
+    }
+    if (position < n) return false;
+
+    // Nodes left over stay idle
+    if (solution) {
+        while (static_cast<int>(solution->core_split_points.size()) < nodes) {
+            solution->node_split_points.push_back(n);
+            solution->core_split_points.push_back(std::vector<int>(cores + 1, n));
+            solution->core_loads.push_back(std::vector<long long>(cores, 0));
+        }
+    }
+    return true;
+}
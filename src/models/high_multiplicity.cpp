@@ -0,0 +1,238 @@
+#include "models/high_multiplicity.hpp"
+#include "models/pseudo_polynomial.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+JobHistogram JobHistogram::fromTimes(const std::vector<int>& times) {
+    map<int, long long, greater<int>> classes;
+    for (int t : times) classes[t]++;
+
+    JobHistogram histogram;
+    for (const auto& entry : classes) {
+        histogram.sizes.push_back(entry.first);
+        histogram.counts.push_back(entry.second);
+    }
+    return histogram;
+}
+
+size_t HighMultiplicitySolver::VectorHash::operator()(const std::vector<long long>& key) const {
+    size_t hash = key.size();
+    for (long long value : key) {
+        hash ^= std::hash<long long>()(value) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+HighMultiplicitySolution HighMultiplicitySolver::solve(const std::vector<int>& times, int m,
+                                                       bool is_test_mode) {
+    HighMultiplicitySolution result;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.status = "invalid_input";
+        std::cerr << "High-multiplicity input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    result = solve(JobHistogram::fromTimes(times), m);
+    if (!result.isValid()) return result;
+
+    // Hand out each machine's quota of every class in job order
+    vector<size_t> next_machine(result.sizes.size(), 0);
+    vector<vector<long long>> quota = result.machine_counts;
+    result.job_machine.resize(times.size());
+    for (size_t job = 0; job < times.size(); job++) {
+        size_t c = lower_bound(result.sizes.begin(), result.sizes.end(), times[job],
+                               greater<int>()) - result.sizes.begin();
+        size_t& k = next_machine[c];
+        while (quota[k][c] == 0) k++;
+        quota[k][c]--;
+        result.job_machine[job] = static_cast<int>(k);
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+HighMultiplicitySolution HighMultiplicitySolver::solve(const JobHistogram& histogram, int m) {
+    HighMultiplicitySolution result;
+    auto start_time = high_resolution_clock::now();
+
+    try {
+        if (m < 1) {
+            throw invalid_argument("m must be positive (m=" + to_string(m) + ")");
+        }
+        if (histogram.sizes.size() != histogram.counts.size()) {
+            throw invalid_argument("Histogram has " + to_string(histogram.sizes.size()) +
+                                   " sizes but " + to_string(histogram.counts.size()) + " counts");
+        }
+
+        // Drop empty classes and merge repeated sizes, longest first
+        map<int, long long, greater<int>> classes;
+        for (size_t c = 0; c < histogram.sizes.size(); c++) {
+            if (histogram.sizes[c] < 1 || histogram.counts[c] < 0) {
+                throw invalid_argument("Class " + to_string(c) + " has size " +
+                                       to_string(histogram.sizes[c]) + " and count " +
+                                       to_string(histogram.counts[c]));
+            }
+            if (histogram.counts[c] > 0) classes[histogram.sizes[c]] += histogram.counts[c];
+        }
+        if (classes.empty()) {
+            throw invalid_argument("Histogram holds no jobs");
+        }
+
+        JobHistogram merged;
+        long long total = 0;
+        long long step = 0;
+        for (const auto& entry : classes) {
+            merged.sizes.push_back(entry.first);
+            merged.counts.push_back(entry.second);
+            total += entry.first * entry.second;
+            step = gcd(step, static_cast<long long>(entry.first));
+        }
+        const int classes_count = static_cast<int>(merged.sizes.size());
+        sizes_ = merged.sizes;
+
+        // Every load is a multiple of the gcd, so only such makespans are tried
+        long long lower = lowerBound(merged, m, total);
+        lower = (lower + step - 1) / step * step;
+        result.lower_bound = lower;
+
+        // Greedy longest-first bins never leave more than max t free, so the
+        // first descent succeeds once T reaches ceil(S/m) + max t
+        const long long greedy_bound = (total + m - 1) / m + merged.sizes.front();
+        const long long greedy_nodes = static_cast<long long>(m) * (classes_count + 2);
+
+        bool proven = true;
+        long long T = lower;
+        for (;; T += step) {
+            remaining_ = merged.counts;
+            node_budget_ = node_limit_ + greedy_nodes;
+            nodes_ = 0;
+            aborted_ = false;
+            capacity_ = T;
+            failed_.clear();
+            bins_.clear();
+
+            bool packed = packBins(m, m * T - total);
+            result.nodes += nodes_;
+            if (packed) break;
+            if (aborted_) proven = false;
+            if (T >= greedy_bound) {
+                throw runtime_error("No packing found at T=" + to_string(T));
+            }
+        }
+
+        result.sizes = merged.sizes;
+        result.machine_counts = bins_;
+        result.machine_counts.resize(m, vector<long long>(classes_count, 0));
+        for (const auto& counts : result.machine_counts) {
+            long long load = 0;
+            for (int c = 0; c < classes_count; c++) load += counts[c] * merged.sizes[c];
+            result.machine_loads.push_back(load);
+        }
+        result.makespan = static_cast<double>(*max_element(result.machine_loads.begin(),
+                                                           result.machine_loads.end()));
+        result.status = (proven || T == lower) ? "optimal" : "feasible";
+        failed_.clear();
+
+    } catch (const invalid_argument& e) {
+        result.status = "invalid_input";
+        std::cerr << "High-multiplicity input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+long long HighMultiplicitySolver::lowerBound(const JobHistogram& histogram, int m, long long total) {
+    long long n = accumulate(histogram.counts.begin(), histogram.counts.end(), 0LL);
+    long long bound = max<long long>(histogram.sizes.front(), (total + m - 1) / m);
+
+    // With n > m some machine runs two of the m + 1 longest jobs
+    if (n > m) {
+        long long rank = 0;
+        long long pair = 0;
+        for (size_t c = 0; c < histogram.sizes.size() && rank < m + 1; c++) {
+            long long taken = min(histogram.counts[c], static_cast<long long>(m) + 1 - rank);
+            long long from = max(rank, static_cast<long long>(m) - 1);
+            long long overlap = min(rank + taken, static_cast<long long>(m) + 1) - from;
+            if (overlap > 0) pair += overlap * histogram.sizes[c];
+            rank += taken;
+        }
+        bound = max(bound, pair);
+    }
+    return bound;
+}
+
+bool HighMultiplicitySolver::packBins(int bins_left, long long waste_left) {
+    size_t first = 0;
+    while (first < remaining_.size() && remaining_[first] == 0) first++;
+    if (first == remaining_.size()) return true;
+    if (bins_left == 0 || waste_left < 0) return false;
+
+    vector<long long> key(remaining_);
+    key.push_back(bins_left);
+    if (failed_.count(key)) return false;
+
+    long long rest = 0;
+    for (size_t c = 0; c < remaining_.size(); c++) rest += remaining_[c] * sizes_[c];
+
+    // The next bin is the one holding the longest remaining job
+    config_.assign(remaining_.size(), 0);
+    bool packed = fillBin(first, capacity_, rest, bins_left, waste_left, true);
+    if (!packed && !aborted_) failed_.insert(move(key));
+    return packed;
+}
+
+bool HighMultiplicitySolver::fillBin(size_t c, long long free, long long rest,
+                                     int bins_left, long long waste_left, bool take_first) {
+    if (++nodes_ > node_budget_) {
+        aborted_ = true;
+        return false;
+    }
+    if (free - rest > waste_left) return false;  // Even every remaining job leaves too much room
+
+    if (c == remaining_.size()) {
+        // Only maximal bins: no remaining job fits into the free space
+        for (size_t j = 0; j < remaining_.size(); j++) {
+            if (remaining_[j] > config_[j] && sizes_[j] <= free) return false;
+        }
+
+        for (size_t j = 0; j < remaining_.size(); j++) remaining_[j] -= config_[j];
+        bins_.push_back(config_);
+        if (packBins(bins_left - 1, waste_left - free)) return true;
+
+        config_ = bins_.back();
+        bins_.pop_back();
+        for (size_t j = 0; j < remaining_.size(); j++) remaining_[j] += config_[j];
+        return false;
+    }
+
+    const long long size = sizes_[c];
+    const long long class_load = remaining_[c] * size;
+    const long long most = min(remaining_[c], free / size);
+    const long long least = take_first ? 1 : 0;
+    for (long long k = most; k >= least; k--) {
+        config_[c] = k;
+        if (fillBin(c + 1, free - k * size, rest - class_load, bins_left, waste_left, false)) {
+            return true;
+        }
+        if (aborted_) break;
+    }
+    config_[c] = 0;
+    return false;
+}
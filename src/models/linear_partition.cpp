@@ -0,0 +1,149 @@
+#include "models/linear_partition.hpp"
+#include "models/prefix_partition.hpp"
+#include <chrono>
+#include <algorithm>
+#include <climits>
+#include <iostream>
+
+using namespace std;
+using namespace std::chrono;
+
+namespace {
+
+    // Square submatrix of the candidate matrix, top-left corner (row, col)
+    struct SubMatrix {
+        int row;
+        int col;
+    };
+
+    // Candidate matrix M(r, c) = P[c + 1] - P[n - 1 - r] for r, c in [0, n), padded with
+    // +infinity up to a power-of-two size. Both rows and columns are non-decreasing.
+    long long candidateValue(const std::vector<long long>& prefix, int r, int c) {
+        const int n = static_cast<int>(prefix.size()) - 1;
+        if (r >= n || c >= n) return LLONG_MAX;
+        return prefix[c + 1] - prefix[n - 1 - r];
+    }
+
+}
+
+PseudoPolySolution LinearPartitionSolver::solve(const std::vector<int>& times, int m, bool is_test_mode) {
+    PseudoPolySolution result;
+    auto start_time = high_resolution_clock::now();
+    
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.status = "invalid_input";
+        result.solve_time = 0.0;
+        std::cerr << "Linear partition input error: " << error_msg << std::endl;
+        return result;
+    }
+    
+    result.feasibility_checks = 0;
+    
+    try {
+        PrefixPartition::buildPrefixSums(times, prefix_);
+        
+        // Same bracket as the parametric search: the upper end is always feasible
+        long long max_time = *max_element(times.begin(), times.end());
+        long long total = prefix_.back();
+        long long average = (total + m - 1) / m;
+        long long lower = max(max_time, average);
+        long long upper = min(total, average + max_time);
+        
+        long long makespan = searchSortedMatrix(m, lower, upper, result.feasibility_checks);
+        result.makespan = static_cast<double>(makespan);
+        PrefixPartition::greedySplitPoints(prefix_, makespan, result.split_points);
+        result.machine_loads = PrefixPartition::blockLoads(prefix_, result.split_points);
+        
+        auto end_time = high_resolution_clock::now();
+        result.solve_time = duration<double>(end_time - start_time).count();
+        result.status = "optimal";
+        
+    } catch (const exception& e) {
+        result.status = string("error: ") + e.what();
+        auto end_time = high_resolution_clock::now();
+        result.solve_time = duration<double>(end_time - start_time).count();
+    }
+    
+    return result;
+}
+
+long long LinearPartitionSolver::searchSortedMatrix(int m, long long lower, long long upper,
+                                                   int& checks) const {
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    
+    // Invariant: every T <= lo is infeasible, hi is feasible, T* lies in (lo, hi]
+    long long lo = lower - 1;
+    long long hi = upper;
+    
+    // Probe value v and move lo/hi to the candidates reported by the greedy
+    auto probe = [&](long long v) {
+        long long candidate;
+        checks++;
+        if (PrefixPartition::probeCandidate(prefix_, v, m, candidate)) {
+            hi = min<long long>(hi, candidate);
+        } else {
+            lo = max<long long>(lo, candidate - 1);
+        }
+    };
+    
+    // Drop submatrices with no value strictly inside (lo, hi)
+    auto prune = [&](std::vector<SubMatrix>& mats, int size) {
+        auto dead = [&](const SubMatrix& s) {
+            return candidateValue(prefix_, s.row + size - 1, s.col + size - 1) <= lo ||
+                   candidateValue(prefix_, s.row, s.col) >= hi;
+        };
+        mats.erase(remove_if(mats.begin(), mats.end(), dead), mats.end());
+    };
+    
+    // Probe the median of the corner values that still lie inside (lo, hi)
+    std::vector<long long> values;
+    auto probeMedian = [&](const std::vector<SubMatrix>& mats, int size) {
+        values.clear();
+        for (const auto& s : mats) {
+            long long smallest = candidateValue(prefix_, s.row, s.col);
+            long long largest = candidateValue(prefix_, s.row + size - 1, s.col + size - 1);
+            if (smallest > lo && smallest < hi) values.push_back(smallest);
+            if (largest > lo && largest < hi) values.push_back(largest);
+        }
+        if (values.empty()) return;
+        auto mid = values.begin() + values.size() / 2;
+        nth_element(values.begin(), mid, values.end());
+        probe(*mid);
+    };
+    
+    int size = 1;
+    while (size < n) size *= 2;
+    
+    std::vector<SubMatrix> mats = {{0, 0}};
+    std::vector<SubMatrix> next;
+    prune(mats, size);
+    
+    // Quarter every surviving submatrix, then spend two median probes per level
+    while (size > 1 && !mats.empty() && lo + 1 < hi) {
+        int half = size / 2;
+        next.clear();
+        for (const auto& s : mats) {
+            next.push_back({s.row, s.col});
+            next.push_back({s.row, s.col + half});
+            next.push_back({s.row + half, s.col});
+            next.push_back({s.row + half, s.col + half});
+        }
+        mats.swap(next);
+        size = half;
+        
+        prune(mats, size);
+        for (int round = 0; round < 2 && !mats.empty(); round++) {
+            probeMedian(mats, size);
+            prune(mats, size);
+        }
+    }
+    
+    // Single cells left: plain median search over the remaining candidates
+    while (!mats.empty() && lo + 1 < hi) {
+        probeMedian(mats, size);
+        prune(mats, size);
+    }
+    
+    return hi;
+}
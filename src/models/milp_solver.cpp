@@ -20,16 +20,9 @@ void MILPSolution::printSummary() const {
         std::cout << "Nodes Explored: " << nodes << std::endl;
         
         std::cout << "\nJob Assignments:" << std::endl;
-        // Исправляем для C++11
-        for (const auto& assignment_pair : assignments) {
-            int machine = assignment_pair.first;
-            const std::vector<int>& jobs = assignment_pair.second;
-            std::cout << "  Machine " << machine << ": Jobs [";
-            for (size_t i = 0; i < jobs.size(); i++) {
-                std::cout << jobs[i];
-                if (i < jobs.size() - 1) std::cout << ", ";
-            }
-            std::cout << "]" << std::endl;
+        for (size_t k = 0; k + 1 < split_points.size(); k++) {
+            std::cout << "  Machine " << k << ": Jobs [" << split_points[k] << ", "
+                      << split_points[k + 1] << ")" << std::endl;
         }
         
         std::cout << "\nMachine Loads:" << std::endl;
@@ -44,6 +37,7 @@ bool MILPSolver::validateInput(const std::vector<int>& times, int m,
     int n = times.size();
     
     if (!is_test_mode) {
+        // The model has n * m binaries, so the production range still applies here
         if (n < 50 || n > 5000) {
             error_msg = "n must be in range [50, 5000] (n=" + std::to_string(n) + ")";
             return false;
@@ -57,10 +51,10 @@ bool MILPSolver::validateInput(const std::vector<int>& times, int m,
     }
     
     for (size_t i = 0; i < times.size(); i++) {
-        if (times[i] < 1 || times[i] > 24) {
+        if (times[i] < 1) {
             error_msg = "Processing time at index " + std::to_string(i) + 
                        " is " + std::to_string(times[i]) + 
-                       ", must be in range [1, 24]";
+                       ", must be positive";
             return false;
         }
     }
@@ -182,7 +176,7 @@ MILPSolution MILPSolver::solve(const std::vector<int>& times, int m,
         int max_time = *std::max_element(times.begin(), times.end());
         model.add(C_max >= max_time);
         // (9) Lower Bound Based on Average Load
-        int total_time = std::accumulate(times.begin(), times.end(), 0);
+        long long total_time = std::accumulate(times.begin(), times.end(), 0LL);
         model.add(C_max >= static_cast<double>(total_time) / m);
         
         // ============================================
@@ -246,23 +240,30 @@ MILPSolution MILPSolver::solve(const std::vector<int>& times, int m,
         result.iterations = cplex.getNiterations();
         result.nodes = cplex.getNnodes();
         
-        // Extract job assignments
-        for (int j = 0; j < m; j++) {
-            std::vector<int> machine_jobs;
-            int machine_load = 0;
-            
-            for (int i = 0; i < n; i++) {
+        // Extract the blocks as split points: contiguity (5) keeps the jobs of a
+        // machine consecutive, so a block ends wherever the machine changes.
+        // Machines left empty get no block.
+        result.split_points.assign(1, 0);
+        int previous_machine = -1;
+        long long machine_load = 0;
+        for (int i = 0; i < n; i++) {
+            int machine = 0;
+            for (int j = 0; j < m; j++) {
                 if (cplex.getValue(x[i][j]) > 0.5) {  // Threshold for binary variable
-                    machine_jobs.push_back(i);
-                    machine_load += times[i];
+                    machine = j;
+                    break;
                 }
             }
-            
-            if (!machine_jobs.empty()) {
-                result.assignments[j] = machine_jobs;
+            if (i > 0 && machine != previous_machine) {
+                result.split_points.push_back(i);
                 result.machine_loads.push_back(machine_load);
+                machine_load = 0;
             }
+            previous_machine = machine;
+            machine_load += times[i];
         }
+        result.split_points.push_back(n);
+        result.machine_loads.push_back(machine_load);
         
         // Clean up
         env.end();
@@ -0,0 +1,243 @@
+#include "models/multi_resource_partition.hpp"
+#include "models/packed_kernels.hpp"
+#include "models/pseudo_polynomial.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MULTI_RESOURCE_X86 1
+#endif
+
+using namespace std;
+using namespace std::chrono;
+
+namespace {
+
+    bool rowFitsScalar(const long long* row, const long long* limits, int resources) {
+        for (int r = 0; r < resources; r++) {
+            if (row[r] > limits[r]) return false;
+        }
+        return true;
+    }
+
+#if defined(MULTI_RESOURCE_X86)
+    // Four resources per compare; lanes past the last resource are masked to
+    // zero on both sides, so they never fail
+    __attribute__((target("avx2")))
+    bool rowFitsAvx2(const long long* row, const long long* limits, int resources) {
+        for (int r = 0; r < resources; r += 4) {
+            int lanes = resources - r;
+            __m256i mask = _mm256_set_epi64x(lanes > 3 ? -1 : 0, lanes > 2 ? -1 : 0,
+                                             lanes > 1 ? -1 : 0, -1);
+            __m256i sums = _mm256_maskload_epi64(row + r, mask);
+            __m256i bounds = _mm256_maskload_epi64(limits + r, mask);
+            if (_mm256_movemask_epi8(_mm256_cmpgt_epi64(sums, bounds)) != 0) return false;
+        }
+        return true;
+    }
+#endif
+
+}
+
+bool MultiResourcePartitionSolver::usesAvx2() {
+#if defined(MULTI_RESOURCE_X86)
+    return PackedKernels::hasAvx2();
+#else
+    return false;
+#endif
+}
+
+MultiResourceSolution MultiResourcePartitionSolver::solve(const std::vector<std::vector<int>>& resources,
+                                                          int m,
+                                                          const std::vector<long long>& capacities,
+                                                          bool is_test_mode) {
+    MultiResourceSolution result;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (resources.empty() || !validateInput(resources[0], m, error_msg, is_test_mode)) {
+        result.status = "invalid_input";
+        std::cerr << "Multi-resource input error: "
+                  << (resources.empty() ? "at least one resource is required" : error_msg) << std::endl;
+        return result;
+    }
+
+    try {
+        const int n = static_cast<int>(resources[0].size());
+        const int d = static_cast<int>(resources.size());
+        if (static_cast<int>(capacities.size()) != d) {
+            throw invalid_argument("Expected " + to_string(d) + " capacities, got " +
+                                   to_string(capacities.size()));
+        }
+        for (int r = 0; r < d; r++) {
+            if (static_cast<int>(resources[r].size()) != n) {
+                throw invalid_argument("Resource " + to_string(r) + " has " +
+                                       to_string(resources[r].size()) + " values, expected " +
+                                       to_string(n));
+            }
+            if (capacities[r] < 1 || capacities[r] > kMaxCapacity) {
+                throw invalid_argument("Capacity of resource " + to_string(r) + " is " +
+                                       to_string(capacities[r]) + ", must be in [1, 1e9]");
+            }
+            for (int j = 0; j < n; j++) {
+                if (resources[r][j] < 0) {
+                    throw invalid_argument("Resource " + to_string(r) + " of job " + to_string(j) +
+                                           " is " + to_string(resources[r][j]) +
+                                           ", must be non-negative");
+                }
+            }
+        }
+
+        // Struct-of-arrays in, one row of d sums per position for the probe
+        resources_ = d;
+        capacities_ = capacities;
+        limits_.resize(d);
+        fits_ = rowFitsScalar;
+#if defined(MULTI_RESOURCE_X86)
+        if (usesAvx2()) fits_ = rowFitsAvx2;
+#endif
+        prefix_.assign(static_cast<size_t>(n + 1) * d, 0);
+        for (int r = 0; r < d; r++) {
+            const int* values = resources[r].data();
+            long long sum = 0;
+            for (int j = 0; j < n; j++) {
+                sum += values[j];
+                prefix_[static_cast<size_t>(j + 1) * d + r] = sum;
+            }
+        }
+
+        // T* lies in [max_r max_j v / c_r, max_r total_r / c_r]; both ends are
+        // block scores (one job, everything on one machine)
+        Fraction left{0, 1};
+        Fraction right{0, 1};
+        for (int r = 0; r < d; r++) {
+            Fraction longest{*max_element(resources[r].begin(), resources[r].end()), capacities[r]};
+            Fraction everything{row(n)[r], capacities[r]};
+            if (less(left, longest)) left = longest;
+            if (less(right, everything)) right = everything;
+        }
+
+        Fraction candidate{0, 1};
+        result.feasibility_checks++;
+        if (probe(left.load, left.units, m, candidate)) {
+            right = candidate;
+        } else {
+            left = candidate;
+        }
+        while (less(left, right)) {
+            __int128 numerator = static_cast<__int128>(left.load) * right.units +
+                                 static_cast<__int128>(right.load) * left.units;
+            __int128 denominator = static_cast<__int128>(2) * left.units * right.units;
+            result.feasibility_checks++;
+            if (probe(numerator, denominator, m, candidate)) {
+                right = candidate;
+            } else {
+                left = candidate;
+            }
+        }
+
+        // Greedy blocks at T*, with their per-resource loads
+        result.split_points.assign(1, 0);
+        for (int position = 0; position < n;) {
+            position = blockEnd(position, right.load, right.units);
+            if (position == result.split_points.back()) {
+                throw runtime_error("Greedy blocks at the optimal makespan do not cover the chain");
+            }
+            result.split_points.push_back(position);
+        }
+        result.resource_loads.assign(d, std::vector<long long>());
+        Fraction worst{0, 1};
+        for (int r = 0; r < d; r++) {
+            for (size_t k = 0; k + 1 < result.split_points.size(); k++) {
+                long long load = row(result.split_points[k + 1])[r] - row(result.split_points[k])[r];
+                result.resource_loads[r].push_back(load);
+                if (less(worst, Fraction{load, capacities[r]})) {
+                    worst = Fraction{load, capacities[r]};
+                    result.bottleneck_resource = r;
+                }
+            }
+        }
+        result.makespan = static_cast<double>(right.load) / static_cast<double>(right.units);
+        result.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        std::cerr << "Multi-resource input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.makespan = -1.0;
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+bool MultiResourcePartitionSolver::less(const Fraction& a, const Fraction& b) {
+    return static_cast<__int128>(a.load) * b.units < static_cast<__int128>(b.load) * a.units;
+}
+
+int MultiResourcePartitionSolver::blockEnd(int start, __int128 numerator, __int128 denominator) {
+    // Largest end whose row stays within start's row plus floor(T c_r) everywhere
+    const int n = static_cast<int>(prefix_.size() / resources_) - 1;
+    const long long* base = row(start);
+    const long long* last = row(n);
+    for (int r = 0; r < resources_; r++) {
+        __int128 room = numerator * capacities_[r] / denominator;
+        limits_[r] = base[r] + static_cast<long long>(min<__int128>(room, last[r] - base[r]));
+    }
+
+    // Invariant: row(low) fits, row(high) does not (or high is past the end)
+    int low = start;
+    int high = n + 1;
+    while (high - low > 1) {
+        int middle = low + (high - low) / 2;
+        if (fits_(row(middle), limits_.data(), resources_)) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+MultiResourcePartitionSolver::Fraction MultiResourcePartitionSolver::score(int start, int end) const {
+    Fraction worst{0, 1};
+    for (int r = 0; r < resources_; r++) {
+        Fraction load{row(end)[r] - row(start)[r], capacities_[r]};
+        if (less(worst, load)) worst = load;
+    }
+    return worst;
+}
+
+bool MultiResourcePartitionSolver::probe(__int128 numerator, __int128 denominator, int m,
+                                         Fraction& candidate) {
+    // Same contract as the single-resource probe: the largest block score when
+    // the blocks cover the chain, else the smallest score of a block plus its
+    // next job, below which every greedy block stays the same
+    const int n = static_cast<int>(prefix_.size() / resources_) - 1;
+    Fraction largest{0, 1};
+    Fraction grown{-1, 1};
+    int position = 0;
+
+    for (int block = 0; block < m; block++) {
+        int end = blockEnd(position, numerator, denominator);
+        Fraction load = score(position, end);
+        if (less(largest, load)) largest = load;
+        if (end == n) {
+            candidate = largest;
+            return true;
+        }
+        Fraction next = score(position, end + 1);
+        if (grown.load < 0 || less(next, grown)) grown = next;
+        if (end == position) break;  // The next job alone exceeds T
+        position = end;
+    }
+
+    candidate = grown;
+    return false;
+}
@@ -0,0 +1,256 @@
+#include "models/packed_kernels.hpp"
+#include <algorithm>
+#include <climits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PACKED_KERNELS_X86 1
+#endif
+
+using namespace std;
+
+namespace PackedKernels {
+
+    namespace {
+
+        // Greedy state carried between the vector body and the scalar tail
+        struct ProbeState {
+            int load = 0;                  // Load of the open block
+            int blocks = 1;                // Blocks opened so far
+            int max_load = 0;              // Largest closed block
+            int next_candidate = INT_MAX;  // Smallest closed load + next job
+        };
+
+        // Close the open block before a job of length t. Returns false when that
+        // proves T infeasible (the job alone exceeds T, or all m blocks are used).
+        inline bool closeBlock(ProbeState& s, int t, int m) {
+            s.next_candidate = min(s.next_candidate, s.load + t);
+            if (s.load == 0 || s.blocks == m) return false;
+            s.max_load = max(s.max_load, s.load);
+            s.blocks++;
+            s.load = 0;
+            return true;
+        }
+
+        bool finishScalar(const uint8_t* times, size_t i, size_t n, int T, int m,
+                          ProbeState& s, int& candidate) {
+            while (i < n) {
+                int t = times[i];
+                if (s.load + t <= T) {
+                    s.load += t;
+                    i++;
+                } else if (!closeBlock(s, t, m)) {
+                    candidate = s.next_candidate;
+                    return false;
+                }
+            }
+            candidate = max(s.max_load, s.load);
+            return true;
+        }
+
+    }
+
+    bool hasAvx2() {
+#if defined(PACKED_KERNELS_X86)
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+#else
+        return false;
+#endif
+    }
+    
+    void packTimes(const std::vector<int>& times, std::vector<uint8_t>& packed) {
+        packed.resize(times.size());
+        for (size_t i = 0; i < times.size(); i++) {
+            packed[i] = static_cast<uint8_t>(times[i]);
+        }
+    }
+    
+    bool probeCandidate(const uint8_t* times, size_t n, int T, int m, int& candidate) {
+        if (hasAvx2()) {
+            return probeCandidateAvx2(times, n, T, m, candidate);
+        }
+        return probeCandidateScalar(times, n, T, m, candidate);
+    }
+    
+    void probeCandidates(const uint8_t* times, size_t n, const int* T, int k, int m,
+                         char* feasible, int* candidates) {
+        if (hasAvx2()) {
+            probeCandidatesAvx2(times, n, T, k, m, feasible, candidates);
+        } else {
+            probeCandidatesScalar(times, n, T, k, m, feasible, candidates);
+        }
+    }
+    
+    void probeCandidatesScalar(const uint8_t* times, size_t n, const int* T, int k, int m,
+                               char* feasible, int* candidates) {
+        // Eight lanes per pass with their state on the stack, as in the AVX2 kernel
+        for (int base = 0; base < k; base += 8) {
+            const int lanes = min(8, k - base);
+            ProbeState states[8];
+            char active[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+            int remaining = lanes;
+            
+            for (size_t i = 0; i < n && remaining > 0; i++) {
+                int t = times[i];
+                for (int lane = 0; lane < lanes; lane++) {
+                    if (!active[lane]) continue;
+                    ProbeState& s = states[lane];
+                    
+                    // Same steps as finishScalar; a block may close twice for one job
+                    // only when that job alone exceeds T, and then the lane stops
+                    while (s.load + t > T[base + lane]) {
+                        if (!closeBlock(s, t, m)) {
+                            active[lane] = 0;
+                            remaining--;
+                            break;
+                        }
+                    }
+                    if (active[lane]) s.load += t;
+                }
+            }
+            
+            for (int lane = 0; lane < lanes; lane++) {
+                feasible[base + lane] = active[lane];
+                candidates[base + lane] = active[lane] ? max(states[lane].max_load, states[lane].load)
+                                                       : states[lane].next_candidate;
+            }
+        }
+    }
+    
+    bool probeCandidateScalar(const uint8_t* times, size_t n, int T, int m, int& candidate) {
+        ProbeState s;
+        return finishScalar(times, 0, n, T, m, s, candidate);
+    }
+    
+#if defined(PACKED_KERNELS_X86)
+    __attribute__((target("avx2")))
+    bool probeCandidateAvx2(const uint8_t* times, size_t n, int T, int m, int& candidate) {
+        ProbeState s;
+        size_t i = 0;
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i last_lane = _mm256_set1_epi16(0x0F0E);  // Bytes of 16-bit lane 7
+        alignas(32) uint16_t prefix[32];
+        
+        while (i + 32 <= n) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(times + i));
+            int room = T - s.load;
+            
+            // Fast path: the whole chunk fits into the open block
+            __m256i sad = _mm256_sad_epu8(bytes, zero);
+            int total = _mm256_extract_epi64(sad, 0) + _mm256_extract_epi64(sad, 1) +
+                        _mm256_extract_epi64(sad, 2) + _mm256_extract_epi64(sad, 3);
+            if (total <= room) {
+                s.load += total;
+                i += 32;
+                continue;
+            }
+            
+            // Inclusive prefix sums of jobs 0..15 and 16..31 in 16-bit lanes
+            // (room < total <= 32 * 255, so every compare fits in int16)
+            __m256i lo = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes));
+            __m256i hi = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1));
+            lo = _mm256_add_epi16(lo, _mm256_slli_si256(lo, 2));
+            hi = _mm256_add_epi16(hi, _mm256_slli_si256(hi, 2));
+            lo = _mm256_add_epi16(lo, _mm256_slli_si256(lo, 4));
+            hi = _mm256_add_epi16(hi, _mm256_slli_si256(hi, 4));
+            lo = _mm256_add_epi16(lo, _mm256_slli_si256(lo, 8));
+            hi = _mm256_add_epi16(hi, _mm256_slli_si256(hi, 8));
+            // Carry the low 128-bit half into the high half
+            lo = _mm256_add_epi16(lo, _mm256_shuffle_epi8(_mm256_permute2x128_si256(lo, lo, 0x08), last_lane));
+            hi = _mm256_add_epi16(hi, _mm256_shuffle_epi8(_mm256_permute2x128_si256(hi, hi, 0x08), last_lane));
+            hi = _mm256_add_epi16(hi, _mm256_set1_epi16(static_cast<short>(_mm256_extract_epi16(lo, 15))));
+            
+            // First job whose inclusive prefix overflows the room left in the block
+            __m256i limit = _mm256_set1_epi16(static_cast<short>(room));
+            unsigned mask_lo = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpgt_epi16(lo, limit)));
+            unsigned mask_hi = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpgt_epi16(hi, limit)));
+            int k = mask_lo ? __builtin_ctz(mask_lo) / 2 : 16 + __builtin_ctz(mask_hi) / 2;
+            
+            _mm256_store_si256(reinterpret_cast<__m256i*>(prefix), lo);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(prefix + 16), hi);
+            s.load += (k > 0) ? prefix[k - 1] : 0;
+            i += k;
+            
+            if (!closeBlock(s, times[i], m)) {
+                candidate = s.next_candidate;
+                return false;
+            }
+        }
+        
+        return finishScalar(times, i, n, T, m, s, candidate);
+    }
+    
+    __attribute__((target("avx2")))
+    void probeCandidatesAvx2(const uint8_t* times, size_t n, const int* T, int k, int m,
+                             char* feasible, int* candidates) {
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i infinity = _mm256_set1_epi32(INT_MAX);
+        const __m256i blocks_limit = _mm256_set1_epi32(m);
+        alignas(32) int thresholds[8];
+        alignas(32) int used[8];
+        alignas(32) int out[4][8];
+        
+        for (int base = 0; base < k; base += 8) {
+            int lanes = min(8, k - base);
+            // Unused lanes start inactive and are never written back
+            for (int lane = 0; lane < 8; lane++) {
+                thresholds[lane] = (lane < lanes) ? T[base + lane] : INT_MAX;
+                used[lane] = (lane < lanes) ? -1 : 0;
+            }
+            
+            __m256i limit = _mm256_load_si256(reinterpret_cast<const __m256i*>(thresholds));
+            __m256i load = _mm256_setzero_si256();
+            __m256i blocks = one;
+            __m256i max_load = _mm256_setzero_si256();
+            __m256i next_candidate = infinity;
+            __m256i active = _mm256_load_si256(reinterpret_cast<const __m256i*>(used));
+            
+            for (size_t i = 0; i < n; i++) {
+                __m256i t = _mm256_set1_epi32(times[i]);
+                __m256i grown = _mm256_add_epi32(load, t);
+                
+                // Lanes whose open block cannot take job i close it (closeBlock)
+                __m256i close = _mm256_and_si256(_mm256_cmpgt_epi32(grown, limit), active);
+                next_candidate = _mm256_blendv_epi8(next_candidate,
+                                                    _mm256_min_epi32(next_candidate, grown), close);
+                __m256i empty = _mm256_cmpeq_epi32(load, _mm256_setzero_si256());
+                __m256i full = _mm256_cmpeq_epi32(blocks, blocks_limit);
+                __m256i fail = _mm256_and_si256(close, _mm256_or_si256(empty, full));
+                __m256i open = _mm256_andnot_si256(fail, close);
+                max_load = _mm256_blendv_epi8(max_load, _mm256_max_epi32(max_load, load), open);
+                blocks = _mm256_add_epi32(blocks, _mm256_and_si256(open, one));
+                active = _mm256_andnot_si256(fail, active);
+                
+                // Job i alone exceeds T in a freshly opened block: one more close, then stop
+                __m256i too_long = _mm256_and_si256(_mm256_cmpgt_epi32(t, limit), open);
+                next_candidate = _mm256_blendv_epi8(next_candidate,
+                                                    _mm256_min_epi32(next_candidate, t), too_long);
+                active = _mm256_andnot_si256(too_long, active);
+                
+                load = _mm256_blendv_epi8(grown, t, open);
+                if (_mm256_testz_si256(active, active)) break;
+            }
+            
+            _mm256_store_si256(reinterpret_cast<__m256i*>(out[0]), active);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(out[1]), load);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(out[2]), max_load);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(out[3]), next_candidate);
+            for (int lane = 0; lane < lanes; lane++) {
+                feasible[base + lane] = out[0][lane] != 0;
+                candidates[base + lane] = out[0][lane] ? max(out[2][lane], out[1][lane])
+                                                       : out[3][lane];
+            }
+        }
+    }
+#else
+    bool probeCandidateAvx2(const uint8_t* times, size_t n, int T, int m, int& candidate) {
+        return probeCandidateScalar(times, n, T, m, candidate);
+    }
+    
+    void probeCandidatesAvx2(const uint8_t* times, size_t n, const int* T, int k, int m,
+                             char* feasible, int* candidates) {
+        probeCandidatesScalar(times, n, T, k, m, feasible, candidates);
+    }
+#endif
+}
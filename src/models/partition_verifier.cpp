@@ -0,0 +1,130 @@
+#include "models/partition_verifier.hpp"
+#include "models/packed_kernels.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PARTITION_VERIFIER_X86 1
+#endif
+
+using namespace std;
+using namespace std::chrono;
+
+long long PartitionVerifier::sumScalar(const int* times, size_t count, int& smallest) {
+    long long sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum += times[i];
+        smallest = min(smallest, times[i]);
+    }
+    return sum;
+}
+
+#if defined(PARTITION_VERIFIER_X86)
+__attribute__((target("avx2")))
+long long PartitionVerifier::sumAvx2(const int* times, size_t count, int& smallest) {
+    // Eight times per step, widened to 64-bit lanes so no partial sum overflows
+    __m256i low_sums = _mm256_setzero_si256();
+    __m256i high_sums = _mm256_setzero_si256();
+    __m256i minimum = _mm256_set1_epi32(INT_MAX);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(times + i));
+        minimum = _mm256_min_epi32(minimum, values);
+        low_sums = _mm256_add_epi64(low_sums, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(values)));
+        high_sums = _mm256_add_epi64(high_sums, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(values, 1)));
+    }
+    alignas(32) long long sums[4];
+    alignas(32) int minima[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_add_epi64(low_sums, high_sums));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(minima), minimum);
+    long long sum = sums[0] + sums[1] + sums[2] + sums[3];
+    for (int lane = 0; lane < 8; lane++) smallest = min(smallest, minima[lane]);
+    return sum + sumScalar(times + i, count - i, smallest);
+}
+#else
+long long PartitionVerifier::sumAvx2(const int* times, size_t count, int& smallest) {
+    return sumScalar(times, count, smallest);
+}
+#endif
+
+CertificateCheck PartitionVerifier::verify(const std::vector<int>& times, int m,
+                                           const std::vector<int>& split_points,
+                                           const std::vector<int>& witness) {
+    CertificateCheck check;
+    auto start_time = high_resolution_clock::now();
+    const int n = static_cast<int>(times.size());
+    auto finish = [&](const std::string& message) {
+        check.message = message;
+        check.verify_time = duration<double>(high_resolution_clock::now() - start_time).count();
+        return check;
+    };
+
+    // Shape checks first, so every position below lies in [0, n]
+    if (m < 1 || n < 1) {
+        return finish("need at least one job and one machine");
+    }
+    if (split_points.size() < 2 || split_points.size() > static_cast<size_t>(m) + 1 ||
+        split_points.front() != 0 || split_points.back() != n ||
+        !is_sorted(split_points.begin(), split_points.end())) {
+        return finish("split points must rise from 0 to n with at most m blocks");
+    }
+    bool witness_shaped = witness.size() == static_cast<size_t>(m) + 1 && witness.front() == 0 &&
+                          witness.back() < n && is_sorted(witness.begin(), witness.end());
+
+    // Every prefix sum the checks read, in increasing order
+    std::vector<int> positions(split_points);
+    if (witness_shaped) {
+        for (int end : witness) {
+            positions.push_back(end);
+            positions.push_back(end + 1);
+        }
+    }
+    sort(positions.begin(), positions.end());
+    positions.erase(unique(positions.begin(), positions.end()), positions.end());
+
+    // One pass: sum the times between consecutive positions
+    const bool avx2 = PackedKernels::hasAvx2();
+    std::vector<long long> sums(positions.size());
+    int smallest = INT_MAX;
+    long long running = 0;
+    int previous = 0;
+    for (size_t k = 0; k < positions.size(); k++) {
+        size_t count = static_cast<size_t>(positions[k] - previous);
+        running += avx2 ? sumAvx2(times.data() + previous, count, smallest)
+                        : sumScalar(times.data() + previous, count, smallest);
+        sums[k] = running;
+        previous = positions[k];
+    }
+    if (smallest < 1) {
+        return finish("processing times must be positive");
+    }
+    auto prefix = [&](int position) {
+        return sums[lower_bound(positions.begin(), positions.end(), position) - positions.begin()];
+    };
+
+    // The partition and its largest block
+    check.makespan = 0;
+    for (size_t k = 0; k + 1 < split_points.size(); k++) {
+        check.makespan = max(check.makespan, prefix(split_points[k + 1]) - prefix(split_points[k]));
+    }
+    check.partition_valid = true;
+    if (!witness_shaped) {
+        return finish("witness must hold m + 1 rising ends from 0 that stop before n");
+    }
+
+    // Each witness block fits T - 1 and overflows it with its next job
+    const long long below = check.makespan - 1;
+    for (int k = 1; k <= m; k++) {
+        long long load = prefix(witness[k]) - prefix(witness[k - 1]);
+        long long grown = prefix(witness[k] + 1) - prefix(witness[k - 1]);
+        if (load > below || grown <= below) {
+            return finish("witness block " + std::to_string(k - 1) + " is not a greedy block at " +
+                          std::to_string(below));
+        }
+    }
+    check.witness_valid = true;
+    return finish("");
+}
@@ -0,0 +1,152 @@
+#include "models/pipeline_partition.hpp"
+#include "models/prefix_partition.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+PseudoPolySolution PipelinePartitionSolver::solve(const std::vector<int>& times,
+                                                  const std::vector<int>& comm, int m,
+                                                  bool is_test_mode) {
+    PseudoPolySolution result;
+    result.feasibility_checks = 0;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        result.solve_time = 0.0;
+        std::cerr << "Pipeline input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    try {
+        const int n = static_cast<int>(times.size());
+        if (static_cast<int>(comm.size()) != n - 1) {
+            throw invalid_argument("Expected " + to_string(n - 1) + " communication costs, got " +
+                                   to_string(comm.size()));
+        }
+        for (size_t i = 0; i < comm.size(); i++) {
+            if (comm[i] < 0) {
+                throw invalid_argument("Communication cost at edge " + to_string(i) + " is " +
+                                       to_string(comm[i]) + ", must be non-negative");
+            }
+        }
+
+        comm_ = comm;
+        PrefixPartition::buildPrefixSums(times, prefix_);
+
+        // Transfers only add cost, so the optimum without them is a lower bound,
+        // and its blocks with their transfers added are feasible
+        PseudoPolySolution work_only = work_solver_.solve(times, m, true);
+        if (work_only.status != "optimal") {
+            throw runtime_error("Work-only solve failed: " + work_only.status);
+        }
+        result.feasibility_checks += work_only.feasibility_checks;
+        long long left = static_cast<long long>(work_only.makespan);
+        long long right = 0;
+        for (size_t k = 0; k + 1 < work_only.split_points.size(); k++) {
+            right = max(right, stageCost(work_only.split_points[k], work_only.split_points[k + 1]));
+        }
+
+        while (left < right) {
+            long long middle = left + (right - left) / 2;
+            result.feasibility_checks++;
+            if (probe(middle, m, false)) {
+                right = middle;
+            } else {
+                left = middle + 1;
+            }
+        }
+
+        // Walk the recorded stage starts back from the end of the chain
+        parent_.assign(n + 1, -1);
+        probe(right, m, true);
+        result.split_points.assign(1, n);
+        for (int end = n; end > 0; end = parent_[end]) {
+            result.split_points.push_back(parent_[end]);
+        }
+        reverse(result.split_points.begin(), result.split_points.end());
+
+        result.machine_loads.clear();
+        for (size_t k = 0; k + 1 < result.split_points.size(); k++) {
+            result.machine_loads.push_back(stageCost(result.split_points[k], result.split_points[k + 1]));
+        }
+        result.makespan = static_cast<double>(*max_element(result.machine_loads.begin(),
+                                                           result.machine_loads.end()));
+        result.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        result.makespan = -1.0;
+        result.status = "invalid_input";
+        std::cerr << "Pipeline input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.makespan = -1.0;
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+bool PipelinePartitionSolver::isFeasible(long long T, int m) {
+    return !prefix_.empty() && m >= 1 && probe(T, m, false);
+}
+
+long long PipelinePartitionSolver::stageCost(int start, int end) const {
+    return prefix_[end] - key(start) + endCost(end);
+}
+
+long long PipelinePartitionSolver::key(int start) const {
+    return prefix_[start] - (start > 0 ? comm_[start - 1] : 0);
+}
+
+long long PipelinePartitionSolver::endCost(int end) const {
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    return end < n ? comm_[end - 1] : 0;
+}
+
+bool PipelinePartitionSolver::probe(long long T, int m, bool record) {
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    leaves_ = 1;
+    while (leaves_ < m) leaves_ *= 2;
+    best_key_.assign(2 * leaves_, LLONG_MIN);
+    best_start_.assign(leaves_, -1);
+    insert(0, key(0), 0);
+
+    // Positions are visited left to right, so every start in the tree lies
+    // before the current end
+    for (int end = 1; end <= n; end++) {
+        int stages = firstAtLeast(prefix_[end] + endCost(end) - T);
+        if (stages < 0) continue;
+        if (record) parent_[end] = best_start_[stages];
+        if (end == n) return true;
+        if (stages + 1 < m) insert(stages + 1, key(end), end);
+    }
+    return false;
+}
+
+void PipelinePartitionSolver::insert(int stages, long long value, int start) {
+    int node = leaves_ + stages;
+    if (value <= best_key_[node]) return;
+    best_key_[node] = value;
+    best_start_[stages] = start;
+    for (node /= 2; node >= 1 && best_key_[node] < value; node /= 2) {
+        best_key_[node] = value;
+    }
+}
+
+int PipelinePartitionSolver::firstAtLeast(long long threshold) const {
+    if (best_key_[1] < threshold) return -1;
+    int node = 1;
+    while (node < leaves_) {
+        node = (best_key_[2 * node] >= threshold) ? 2 * node : 2 * node + 1;
+    }
+    return node - leaves_;
+}
@@ -0,0 +1,207 @@
+#include "models/prefix_partition.hpp"
+#include "models/parallel_for.hpp"
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+using namespace std;
+
+namespace PrefixPartition {
+
+    template <typename TimeT, typename AccT>
+    void buildPrefixSums(const std::vector<TimeT>& times, std::vector<AccT>& prefix) {
+        prefix.resize(times.size() + 1);
+        prefix[0] = 0;
+        AccT running = 0;
+        for (size_t i = 0; i < times.size(); i++) {
+            running += times[i];
+            prefix[i + 1] = running;
+        }
+    }
+    
+    template <typename TimeT, typename AccT>
+    void buildPrefixSums(const std::vector<TimeT>& times, std::vector<AccT>& prefix, int workers) {
+        const size_t n = times.size();
+        workers = static_cast<int>(min<size_t>(max(workers, 1), max<size_t>(n, 1)));
+        if (workers == 1) {
+            buildPrefixSums(times, prefix);  // No offsets table to allocate
+            return;
+        }
+        prefix.resize(n + 1);
+        prefix[0] = 0;
+        
+        vector<AccT> offsets(workers + 1, 0);
+        parallelFor(workers, n, [&](int w, size_t begin, size_t end) {
+            offsets[w + 1] = accumulate(times.begin() + begin, times.begin() + end, AccT(0));
+        });
+        partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        parallelFor(workers, n, [&](int w, size_t begin, size_t end) {
+            AccT running = offsets[w];
+            for (size_t i = begin; i < end; i++) {
+                running += times[i];
+                prefix[i + 1] = running;
+            }
+        });
+    }
+    
+    template <typename AccT>
+    int nextBoundary(const std::vector<AccT>& prefix, int start, AccT T) {
+        auto it = upper_bound(prefix.begin() + start + 1, prefix.end(), prefix[start] + T);
+        return static_cast<int>(it - prefix.begin()) - 1;
+    }
+    
+    template <typename AccT>
+    bool isFeasible(const std::vector<AccT>& prefix, AccT T, int m) {
+        const int n = static_cast<int>(prefix.size()) - 1;
+        int pos = 0;
+        
+        for (int block = 0; block < m; block++) {
+            int next = nextBoundary(prefix, pos, T);
+            if (next == pos) return false;  // Job `pos` is longer than T
+            if (next == n) return true;
+            pos = next;
+        }
+        return false;
+    }
+    
+    template <typename AccT>
+    bool probeCandidate(const std::vector<AccT>& prefix, AccT T, int m, AccT& candidate) {
+        // Every value in [max load, T] yields the same blocks, and so does every
+        // value in [T, min(load + next job)) when the blocks overflow
+        const int n = static_cast<int>(prefix.size()) - 1;
+        int pos = 0;
+        AccT max_load = 0;
+        AccT next_candidate = numeric_limits<AccT>::max();
+        
+        for (int block = 0; block < m; block++) {
+            int next = nextBoundary(prefix, pos, T);
+            AccT load = prefix[next] - prefix[pos];
+            
+            if (next == n) {
+                candidate = max(max_load, load);
+                return true;
+            }
+            
+            next_candidate = min<AccT>(next_candidate, load + prefix[next + 1] - prefix[next]);
+            if (next == pos) break;  // Job `pos` is longer than T
+            max_load = max(max_load, load);
+            pos = next;
+        }
+        
+        candidate = next_candidate;
+        return false;
+    }
+    
+    template <typename AccT>
+    void probeCandidates(const std::vector<AccT>& prefix, const AccT* T, int k, int m,
+                         char* feasible, AccT* candidates) {
+        // Lanes advance in groups of kLaneGroup whose cursors live on the stack,
+        // so a probe never allocates
+        const int kLaneGroup = 8;
+        const int n = static_cast<int>(prefix.size()) - 1;
+        
+        for (int base = 0; base < k; base += kLaneGroup) {
+            const int lanes = min(kLaneGroup, k - base);
+            int pos[kLaneGroup] = {};
+            AccT max_load[kLaneGroup] = {};
+            char active[kLaneGroup];
+            int remaining = lanes;
+            
+            for (int lane = 0; lane < lanes; lane++) {
+                active[lane] = 1;
+                feasible[base + lane] = 0;
+                candidates[base + lane] = numeric_limits<AccT>::max();
+            }
+            
+            for (int block = 0; block < m && remaining > 0; block++) {
+                for (int lane = 0; lane < lanes; lane++) {
+                    if (!active[lane]) continue;
+                    
+                    int next = nextBoundary(prefix, pos[lane], T[base + lane]);
+                    AccT load = prefix[next] - prefix[pos[lane]];
+                    AccT& candidate = candidates[base + lane];
+                    
+                    if (next == n) {
+                        feasible[base + lane] = 1;
+                        candidate = max(max_load[lane], load);
+                        active[lane] = 0;
+                        remaining--;
+                        continue;
+                    }
+                    
+                    candidate = min<AccT>(candidate, load + prefix[next + 1] - prefix[next]);
+                    if (next == pos[lane]) {  // Job longer than T
+                        active[lane] = 0;
+                        remaining--;
+                        continue;
+                    }
+                    max_load[lane] = max(max_load[lane], load);
+                    pos[lane] = next;
+                }
+            }
+        }
+    }
+    
+    template <typename AccT>
+    void greedySplitPoints(const std::vector<AccT>& prefix, AccT T, std::vector<int>& split_points) {
+        const int n = static_cast<int>(prefix.size()) - 1;
+        split_points.assign(1, 0);
+        
+        int start = 0;
+        while (start < n) {
+            int end = nextBoundary(prefix, start, T);
+            if (end == start) end = start + 1;  // Cannot happen for T >= max(t)
+            split_points.push_back(end);
+            start = end;
+        }
+    }
+    
+    template <typename AccT>
+    std::vector<long long> blockLoads(const std::vector<AccT>& prefix,
+                                      const std::vector<int>& split_points) {
+        vector<long long> loads;
+        blockLoads(prefix, split_points, loads);
+        return loads;
+    }
+    
+    template <typename AccT>
+    void blockLoads(const std::vector<AccT>& prefix, const std::vector<int>& split_points,
+                    std::vector<long long>& loads) {
+        loads.clear();
+        for (size_t b = 0; b + 1 < split_points.size(); b++) {
+            loads.push_back(static_cast<long long>(prefix[split_points[b + 1]] - prefix[split_points[b]]));
+        }
+    }
+    
+    // ============================================
+    // EXPLICIT INSTANTIATIONS
+    // ============================================
+    
+#define PREFIX_PARTITION_INSTANTIATE(AccT) \
+    template int nextBoundary<AccT>(const std::vector<AccT>&, int, AccT); \
+    template bool isFeasible<AccT>(const std::vector<AccT>&, AccT, int); \
+    template bool probeCandidate<AccT>(const std::vector<AccT>&, AccT, int, AccT&); \
+    template void probeCandidates<AccT>(const std::vector<AccT>&, const AccT*, int, int, \
+                                        char*, AccT*); \
+    template void greedySplitPoints<AccT>(const std::vector<AccT>&, AccT, std::vector<int>&); \
+    template std::vector<long long> blockLoads<AccT>(const std::vector<AccT>&, const std::vector<int>&); \
+    template void blockLoads<AccT>(const std::vector<AccT>&, const std::vector<int>&, \
+                                   std::vector<long long>&);
+    
+#define PREFIX_SUMS_INSTANTIATE(TimeT, AccT) \
+    template void buildPrefixSums<TimeT, AccT>(const std::vector<TimeT>&, std::vector<AccT>&); \
+    template void buildPrefixSums<TimeT, AccT>(const std::vector<TimeT>&, std::vector<AccT>&, int);
+    
+    PREFIX_PARTITION_INSTANTIATE(int)
+    PREFIX_PARTITION_INSTANTIATE(long long)
+    PREFIX_PARTITION_INSTANTIATE(uint32_t)
+    PREFIX_PARTITION_INSTANTIATE(uint64_t)
+    
+    PREFIX_SUMS_INSTANTIATE(int, int)
+    PREFIX_SUMS_INSTANTIATE(int, long long)
+    PREFIX_SUMS_INSTANTIATE(int, uint32_t)
+    PREFIX_SUMS_INSTANTIATE(int, uint64_t)
+    
+#undef PREFIX_PARTITION_INSTANTIATE
+#undef PREFIX_SUMS_INSTANTIATE
+}
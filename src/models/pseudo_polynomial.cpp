@@ -1,24 +1,46 @@
 #include "models/pseudo_polynomial.hpp"
+#include "models/prefix_partition.hpp"
+#include "models/packed_kernels.hpp"
+#include "models/fixed_m_kernels.hpp"
+#include "models/parallel_for.hpp"
 #include <chrono>
 #include <algorithm>
 #include <numeric>
 #include <iostream>
+#include <cmath>
+#include <climits>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 using namespace std;
 using namespace std::chrono;
 
+namespace {
+    // Worker threads for an instance of n jobs
+    int workersFor(const PseudoPolyOptions& options, size_t n) {
+        return (static_cast<long long>(n) >= options.parallel_min_jobs) ? resolveWorkers(options.threads) : 1;
+    }
+}
+
 bool validateInput(const std::vector<int>& times, int m, 
-                   std::string& error_msg, bool is_test_mode = false) {
+                   std::string& error_msg, bool is_test_mode, int workers) {
     int n = times.size();
     
     if (!is_test_mode) {
-        // Production mode: n must be in [50, 5000]
-        if (n < 50 || n > 5000) {
-            error_msg = "n must be in range [50, 5000] (n=" + std::to_string(n) + ")";
+        // Production mode: at least 50 jobs; long chains are handled by the wide engine
+        if (n < 50) {
+            error_msg = "n must be at least 50 (n=" + std::to_string(n) + ")";
             return false;
         }
     } 
     
+    // Check m >= 1 condition
+    if (m < 1) {
+        error_msg = "m must be positive (m=" + std::to_string(m) + ")";
+        return false;
+    }
+    
     // Check n > m condition
     if (n <= m) {
         error_msg = "n must be greater than m (n=" + std::to_string(n) + 
@@ -26,50 +48,160 @@ bool validateInput(const std::vector<int>& times, int m,
         return false;
     }
     
-    // Check processing times are in range [1, 24]
-    for (size_t i = 0; i < times.size(); i++) {
-        if (times[i] < 1 || times[i] > 24) {
-            error_msg = "Processing time at index " + std::to_string(i) + 
-                       " is " + std::to_string(times[i]) + 
-                       ", must be in range [1, 24]";
-            return false;
-        }
+    // Check processing times are positive; the first bad index over all workers is reported
+    size_t i = parallelReduce(workers, times.size(), times.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; j++) {
+                if (times[j] < 1) return j;
+            }
+            return times.size();
+        },
+        [](size_t a, size_t b) { return min(a, b); });
+    if (i < times.size()) {
+        error_msg = "Processing time at index " + std::to_string(i) + 
+                   " is " + std::to_string(times[i]) + 
+                   ", must be positive";
+        return false;
     }
     
     return true;
 }
 
+// ============================================
+// DISPATCHING FRONT END
+// ============================================
+
+bool PseudoPolynomialSolver::selectNarrow(const std::vector<int>& times, int workers) {
+    // (total, max time) over all workers
+    pair<long long, int> bounds = parallelReduce(workers, times.size(), make_pair(0LL, 0),
+        [&](size_t begin, size_t end) {
+            pair<long long, int> range(0LL, 0);
+            for (size_t i = begin; i < end; i++) {
+                range.first += times[i];
+                range.second = max(range.second, times[i]);
+            }
+            return range;
+        },
+        [](pair<long long, int> a, pair<long long, int> b) {
+            return make_pair(a.first + b.first, max(a.second, b.second));
+        });
+    used_narrow_ = NarrowPseudoPolySolver::fits(bounds.second, bounds.first);
+    return used_narrow_;
+}
+
 PseudoPolySolution PseudoPolynomialSolver::solve(const std::vector<int>& times, int m, bool is_test_mode) {
     PseudoPolySolution result;
-    auto start_time = high_resolution_clock::now();
-    
+    solve(times, m, result, is_test_mode);
+    return result;
+}
+
+void PseudoPolynomialSolver::solve(const std::vector<int>& times, int m, PseudoPolySolution& result,
+                                   bool is_test_mode) {
     // Validate input with test mode flag
+    const int workers = workersFor(options_, times.size());
     std::string error_msg;
-    if (!validateInput(times, m, error_msg, is_test_mode)) {
+    if (!validateInput(times, m, error_msg, is_test_mode, workers)) {
+        result.split_points.clear();
+        result.machine_loads.clear();
+        result.witness.clear();
         result.status = "invalid_input";
         result.solve_time = 0.0;
+        result.feasibility_checks = 0;
         std::cerr << "Pseudo-polynomial input error: " << error_msg << std::endl;
-        return result;
+        return;
+    }
+    
+    if (selectNarrow(times, workers)) {
+        narrow_.solve(times, m, result);
+    } else {
+        wide_.solve(times, m, result);
+    }
+}
+
+CapacityProfile PseudoPolynomialSolver::capacityProfile(const std::vector<int>& times, int max_machines,
+                                                       long long target_makespan) {
+    return selectNarrow(times, workersFor(options_, times.size())) ? narrow_.capacityProfile(times, max_machines, target_makespan)
+                               : wide_.capacityProfile(times, max_machines, target_makespan);
+}
+
+// ============================================
+// TYPED ENGINE
+// ============================================
+
+namespace {
+    // Byte times are what the packed kernels stream over
+    template <typename TimeT>
+    constexpr bool kByteTimes = std::is_same<TimeT, uint8_t>::value;
+}
+
+template <typename TimeT, typename AccT>
+bool BasicPseudoPolynomialSolver<TimeT, AccT>::fits(long long max_time, long long total) {
+    // Jumps compare prefix[i] + T < 2 * total; the packed kernels keep loads in int
+    long long limit = static_cast<long long>(min<uint64_t>(numeric_limits<AccT>::max() / 2, LLONG_MAX));
+    if (kByteTimes<TimeT>) {
+        limit = min<long long>(limit, INT_MAX);
     }
+    return max_time <= static_cast<long long>(numeric_limits<TimeT>::max()) && total <= limit;
+}
+
+template <typename TimeT, typename AccT>
+PseudoPolySolution BasicPseudoPolynomialSolver<TimeT, AccT>::solve(const std::vector<int>& times, int m) {
+    PseudoPolySolution result;
+    solve(times, m, result);
+    return result;
+}
+
+template <typename TimeT, typename AccT>
+void BasicPseudoPolynomialSolver<TimeT, AccT>::solve(const std::vector<int>& times, int m,
+                                                     PseudoPolySolution& result) {
+    auto start_time = high_resolution_clock::now();
     
     // Initialize counters
     result.feasibility_checks = 0;
     
     try {
+        // Prefix sums are shared by every feasibility probe and the reconstruction;
+        // the packed kernel streams over bytes and needs them only afterwards
+        kernel_ = selectKernel(static_cast<int>(times.size()), m);
+        workers_ = workersFor(options_, times.size());
+        lanes_ = max(max(1, options_.probe_lanes), workers_);
+        if (kernel_ == ProbeKernel::PackedScan) {
+            loadTimes(times);
+        } else {
+            PrefixPartition::buildPrefixSums(times, prefix_, workers_);
+        }
+        
         // Find optimal makespan using binary search
-        result.makespan = findOptimalMakespan(times, m, result.feasibility_checks);
+        AccT makespan = findOptimalMakespan(m, result.feasibility_checks);
+        result.makespan = static_cast<double>(makespan);
         
-        // Reconstruct partition
-        result.partition = reconstructPartition(times, m, result.makespan);
+        if (kernel_ == ProbeKernel::PackedScan) {
+            PrefixPartition::buildPrefixSums(times, prefix_, workers_);
+        }
+        
+        // Reconstruct the blocks as split points: O(m log n), nothing per job
+        if (kernel_ == ProbeKernel::FixedM) {
+            int split_points[FixedMKernels::kMaxMachines + 1];
+            int count = FixedMKernels::splitPointsFor<AccT>(m)(
+                prefix_.data(), static_cast<int>(prefix_.size()) - 1, makespan, split_points);
+            result.split_points.assign(split_points, split_points + count);
+        } else {
+            PrefixPartition::greedySplitPoints(prefix_, makespan, result.split_points);
+        }
         
         // Calculate machine loads
-        result.machine_loads.clear();
-        for (const auto& block : result.partition) {
-            int load = 0;
-            for (int job_idx : block) {
-                load += times[job_idx];
+        PrefixPartition::blockLoads(prefix_, result.split_points, result.machine_loads);
+        
+        // Witness for T* - 1: m greedy blocks that each overflow with their next
+        // job and still end before n (a job longer than T* - 1 repeats its end)
+        result.witness.clear();
+        if (options_.certificate) {
+            int end = 0;
+            result.witness.push_back(end);
+            for (int block = 0; block < m; block++) {
+                end = PrefixPartition::nextBoundary(prefix_, end, static_cast<AccT>(makespan - 1));
+                result.witness.push_back(end);
             }
-            result.machine_loads.push_back(load);
         }
         
         // Calculate solve time
@@ -84,75 +216,228 @@ PseudoPolySolution PseudoPolynomialSolver::solve(const std::vector<int>& times,
         auto end_time = high_resolution_clock::now();
         result.solve_time = duration<double>(end_time - start_time).count();
     }
-    
-    return result;
 }
 
-bool PseudoPolynomialSolver::isFeasible(int T, const std::vector<int>& times, int m) {
-    int blocks_needed = 1;
-    int current_sum = 0;
-    
-    for (int t : times) {
-        if (t > T) return false;
-        
-        if (current_sum + t <= T) {
-            current_sum += t;
-        } else {
-            blocks_needed++;
-            current_sum = t;
-            if (blocks_needed > m) return false;
+template <typename TimeT, typename AccT>
+void BasicPseudoPolynomialSolver<TimeT, AccT>::loadTimes(const std::vector<int>& times) {
+    times_.resize(times.size());
+    parallelFor(workers_, times.size(), [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            times_[i] = static_cast<TimeT>(times[i]);
         }
+    });
+}
+
+template <typename TimeT, typename AccT>
+ProbeKernel BasicPseudoPolynomialSolver<TimeT, AccT>::selectKernel(int n, int m) const {
+    ProbeKernel kernel = options_.probe_kernel;
+    if (kernel == ProbeKernel::Auto) {
+        // A jump probe costs ~m log2(n) binary-search steps, a packed scan reads
+        // all n bytes and closes every block in scalar code. Measured per probe
+        // (n = 1e4..1e6), the scan only wins once m log2(n) exceeds about 3n.
+        kernel = (m * std::log2(n + 1.0) > 3.0 * n) ? ProbeKernel::PackedScan
+                                                    : ProbeKernel::FixedM;
     }
-    return true;
+    // Only byte times can be streamed by the packed kernels
+    if (kernel == ProbeKernel::PackedScan && !kByteTimes<TimeT>) {
+        kernel = ProbeKernel::FixedM;
+    }
+    // The specialized jumps exist for 1 <= m <= kMaxMachines only
+    if (kernel == ProbeKernel::FixedM && (m < 1 || m > FixedMKernels::kMaxMachines)) {
+        kernel = ProbeKernel::PrefixJumps;
+    }
+    return kernel;
 }
 
-int PseudoPolynomialSolver::findOptimalMakespan(const std::vector<int>& times, int m, int& feasibility_checks) {
-    // Lower bound: maximum processing time
-    int left = *max_element(times.begin(), times.end());
+template <typename TimeT, typename AccT>
+void BasicPseudoPolynomialSolver<TimeT, AccT>::probeThresholds(int m) {
+    // All thresholds share one pass over the data; with several workers the
+    // lanes are split between them
+    int k = static_cast<int>(thresholds_.size());
+    lane_feasible_.resize(k);
+    lane_candidates_.resize(k);
     
-    // Upper bound: sum of all processing times
-    int right = accumulate(times.begin(), times.end(), 0);
+    if (kernel_ == ProbeKernel::FixedM) {
+        // One unrolled probe per lane; selectKernel guarantees 1 <= m <= kMaxMachines
+        const auto probe = FixedMKernels::probeFor<AccT>(m);
+        const int n = static_cast<int>(prefix_.size()) - 1;
+        parallelFor(min(workers_, k), k, [&](int, size_t begin, size_t end) {
+            for (size_t lane = begin; lane < end; lane++) {
+                lane_feasible_[lane] = probe(prefix_.data(), n, thresholds_[lane], lane_candidates_[lane]);
+            }
+        });
+        return;
+    }
     
-    feasibility_checks = 0;
+    if constexpr (kByteTimes<TimeT>) {
+        if (kernel_ == ProbeKernel::PackedScan) {
+            // fits() keeps every threshold and candidate within int
+            packed_thresholds_.assign(thresholds_.begin(), thresholds_.end());
+            packed_candidates_.resize(k);
+            parallelFor(min(workers_, k), k, [&](int, size_t begin, size_t end) {
+                PackedKernels::probeCandidates(times_.data(), times_.size(),
+                                               packed_thresholds_.data() + begin,
+                                               static_cast<int>(end - begin), m,
+                                               lane_feasible_.data() + begin,
+                                               packed_candidates_.data() + begin);
+            });
+            copy(packed_candidates_.begin(), packed_candidates_.end(), lane_candidates_.begin());
+            return;
+        }
+    }
+    
+    parallelFor(min(workers_, k), k, [&](int, size_t begin, size_t end) {
+        PrefixPartition::probeCandidates(prefix_, thresholds_.data() + begin,
+                                         static_cast<int>(end - begin), m,
+                                         lane_feasible_.data() + begin,
+                                         lane_candidates_.data() + begin);
+    });
+}
+
+template <typename TimeT, typename AccT>
+AccT BasicPseudoPolynomialSolver<TimeT, AccT>::searchRange(AccT left, AccT right, int m, bool snap,
+                                                           int& feasibility_checks) {
+    // T* lies in [left, right] and right is feasible. Each probe tests up to k
+    // evenly spaced thresholds in [left, right), so the bracket shrinks by a
+    // factor k + 1 per pass (k = 1 is plain bisection).
+    const int lanes = lanes_;
     
-    // Binary search
     while (left < right) {
-        int mid = left + (right - left) / 2;
+        thresholds_.clear();
+        for (int lane = 1; lane <= lanes; lane++) {
+            AccT T = left + static_cast<AccT>(static_cast<uint64_t>(right - left) * lane / (lanes + 1));
+            if (thresholds_.empty() || T > thresholds_.back()) thresholds_.push_back(T);
+        }
+        
         feasibility_checks++;
+        probeThresholds(m);
         
-        if (isFeasible(mid, times, m)) {
-            right = mid;  // Can try smaller makespan
-        } else {
-            left = mid + 1;  // Need larger makespan
+        for (size_t lane = 0; lane < thresholds_.size(); lane++) {
+            AccT T = thresholds_[lane];
+            if (lane_feasible_[lane]) {
+                // Achieved bottleneck (<= T) when snapping, else T itself
+                right = min(right, snap ? lane_candidates_[lane] : T);
+            } else {
+                // Next value where the greedy changes (> T) when snapping, else T + 1
+                left = max(left, snap ? lane_candidates_[lane] : static_cast<AccT>(T + 1));
+            }
         }
     }
     
     return left;
 }
 
-std::vector<std::vector<int>> PseudoPolynomialSolver::reconstructPartition(
-    const std::vector<int>& times, int m, int T_opt) {
+template <typename TimeT, typename AccT>
+AccT BasicPseudoPolynomialSolver<TimeT, AccT>::findOptimalMakespan(int m, int& feasibility_checks) {
+    feasibility_checks = 0;
+    // (max time, total), each worker scanning one range of the jobs
+    const bool packed = (kernel_ == ProbeKernel::PackedScan);
+    const size_t n = packed ? times_.size() : prefix_.size() - 1;
+    pair<AccT, AccT> bounds = parallelReduce(workers_, n, make_pair(AccT(0), AccT(0)),
+        [&](size_t begin, size_t end) {
+            pair<AccT, AccT> range(0, 0);
+            for (size_t i = begin; i < end; i++) {
+                AccT t = packed ? static_cast<AccT>(times_[i]) : prefix_[i + 1] - prefix_[i];
+                range.first = max(range.first, t);
+                range.second += t;
+            }
+            return range;
+        },
+        [](pair<AccT, AccT> a, pair<AccT, AccT> b) {
+            return make_pair(max(a.first, b.first), static_cast<AccT>(a.second + b.second));
+        });
+    const AccT max_time = bounds.first;
+    const AccT total = bounds.second;
     
-    vector<vector<int>> partition;
-    vector<int> current_block;
-    int current_sum = 0;
+    if (options_.search_mode == SearchMode::Bisection) {
+        // Lower bound: maximum processing time, upper bound: sum of all processing times
+        return searchRange(max_time, total, m, false, feasibility_checks);
+    }
     
-    for (int i = 0; i < times.size(); i++) {
-        if (current_sum + times[i] <= T_opt) {
-            current_block.push_back(i);
-            current_sum += times[i];
-        } else {
-            partition.push_back(current_block);
-            current_block.clear();
-            current_block.push_back(i);
-            current_sum = times[i];
-        }
+    // Standard bounds: max(max t, ceil(sum/m)) <= T* <= ceil(sum/m) + max t.
+    // The upper bound is always feasible: every greedy block but the last one
+    // carries more than ceil(sum/m), so m blocks cannot run out of capacity.
+    // Each probe then snaps the bracket onto candidate makespans (prefix-sum
+    // differences), so it shrinks at least as fast as plain bisection.
+    AccT average = (total + m - 1) / m;
+    return searchRange(max(max_time, average), min<AccT>(total, average + max_time), m, true,
+                       feasibility_checks);
+}
+
+
+template <typename TimeT, typename AccT>
+CapacityProfile BasicPseudoPolynomialSolver<TimeT, AccT>::capacityProfile(const std::vector<int>& times,
+                                                                           int max_machines,
+                                                                           long long target_makespan) {
+    CapacityProfile profile;
+    auto start_time = high_resolution_clock::now();
+    profile.target_makespan = target_makespan;
+    
+    if (times.empty() || max_machines < 1) {
+        return profile;
     }
     
-    // Add the last block
-    if (!current_block.empty()) {
-        partition.push_back(current_block);
+    // Every query of the profile runs on the same prefix sums
+    kernel_ = ProbeKernel::PrefixJumps;
+    workers_ = workersFor(options_, times.size());
+    lanes_ = max(max(1, options_.probe_lanes), workers_);
+    PrefixPartition::buildPrefixSums(times, prefix_, workers_);
+    
+    AccT max_time = static_cast<AccT>(*max_element(times.begin(), times.end()));
+    AccT total = prefix_.back();
+    profile.makespan_by_machines.assign(max_machines, 0);
+    fillCurve(1, max_machines, max_time, total, max_time, profile);
+    
+    // Targets beyond the total behave like the total; negative ones are unreachable
+    AccT target = static_cast<AccT>(min<long long>(max(target_makespan, 0LL),
+                                                   static_cast<long long>(total)));
+    profile.min_machines = minMachines(target);
+    
+    auto end_time = high_resolution_clock::now();
+    profile.solve_time = duration<double>(end_time - start_time).count();
+    return profile;
+}
+
+template <typename TimeT, typename AccT>
+void BasicPseudoPolynomialSolver<TimeT, AccT>::fillCurve(int first, int last, AccT lower, AccT upper,
+                                                         AccT max_time, CapacityProfile& profile) {
+    // All of T*(first..last) lie in [lower, upper], and upper is feasible for first
+    if (first > last) return;
+    
+    if (lower == upper) {
+        fill(profile.makespan_by_machines.begin() + (first - 1),
+             profile.makespan_by_machines.begin() + last, static_cast<long long>(lower));
+        return;
     }
     
-    return partition;
-}
\ No newline at end of file
+    int k = first + (last - first) / 2;
+    AccT total = prefix_.back();
+    AccT average = (total + k - 1) / k;
+    AccT left = max(lower, max(max_time, average));
+    AccT right = min(upper, min<AccT>(total, average + max_time));
+    
+    AccT makespan = searchRange(left, right, k, true, profile.feasibility_checks);
+    profile.makespan_by_machines[k - 1] = static_cast<long long>(makespan);
+    
+    fillCurve(first, k - 1, makespan, upper, max_time, profile);
+    fillCurve(k + 1, last, lower, makespan, max_time, profile);
+}
+
+template <typename TimeT, typename AccT>
+int BasicPseudoPolynomialSolver<TimeT, AccT>::minMachines(AccT target) const {
+    // The greedy uses the fewest blocks for a given makespan
+    const int n = static_cast<int>(prefix_.size()) - 1;
+    int pos = 0;
+    int blocks = 0;
+    
+    while (pos < n) {
+        int next = PrefixPartition::nextBoundary(prefix_, pos, target);
+        if (next == pos) return -1;  // A job longer than the target
+        pos = next;
+        blocks++;
+    }
+    return blocks;
+}
+
+template class BasicPseudoPolynomialSolver<uint8_t, uint32_t>;
+template class BasicPseudoPolynomialSolver<uint32_t, uint64_t>;
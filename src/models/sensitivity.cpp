@@ -0,0 +1,117 @@
+#include "models/sensitivity.hpp"
+#include "models/prefix_partition.hpp"
+#include "models/pseudo_polynomial.hpp"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+using namespace std::chrono;
+
+SensitivityReport SensitivityAnalyzer::analyze(const std::vector<int>& times, int m,
+                                               bool is_test_mode) {
+    SensitivityReport report;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        report.status = "invalid_input";
+        std::cerr << "Sensitivity input error: " << error_msg << std::endl;
+        return report;
+    }
+
+    try {
+        const int n = static_cast<int>(times.size());
+
+        PseudoPolynomialSolver solver;
+        PseudoPolySolution solution = solver.solve(times, m, true);
+        if (solution.status != "optimal") {
+            throw runtime_error("Solve failed: " + solution.status);
+        }
+        report.feasibility_checks = solution.feasibility_checks;
+        const long long T = static_cast<long long>(solution.makespan);
+
+        std::vector<long long> prefix;
+        PrefixPartition::buildPrefixSums(times, prefix);
+
+        // forward[k]: furthest end of k greedy blocks from the left, so [0, a)
+        // needs k blocks for forward[k - 1] < a <= forward[k]
+        std::vector<int> forward(1, 0);
+        while (forward.back() < n) {
+            forward.push_back(PrefixPartition::nextBoundary(prefix, forward.back(), T));
+        }
+        // backward[c]: earliest start of c greedy blocks from the right, 0 once
+        // they cover the chain
+        std::vector<int> backward(1, n);
+        while (backward.back() > 0) {
+            long long reach = prefix[backward.back()] - T;
+            backward.push_back(static_cast<int>(
+                lower_bound(prefix.begin(), prefix.begin() + backward.back(), reach) - prefix.begin()));
+        }
+
+        // Earliest end of the block starting at a, with the rest after it on
+        // the m - 1 - blocks(a) other machines; -1 if [0, a) already needs m
+        auto earliestEnd = [&](int a) {
+            int blocks = static_cast<int>(lower_bound(forward.begin(), forward.end(), a) - forward.begin());
+            int others = m - 1 - blocks;
+            if (others < 0) return -1;
+            return others < static_cast<int>(backward.size()) ? backward[others] : 0;
+        };
+
+        // Starts a <= ready have their earliest end at or before i + 1, so their
+        // block ends right after i; later starts a <= i pay their own earliest
+        // end, and the lightest of those comes from a monotone deque
+        report.slack.resize(n);
+        std::deque<std::pair<int, long long>> window;  // (start, block load), loads increasing
+        int ready = -1;
+        for (int i = 0; i < n; i++) {
+            int end = earliestEnd(i);
+            if (end >= 0) {
+                long long weight = prefix[max(end, i + 1)] - prefix[i];
+                while (!window.empty() && window.back().second >= weight) window.pop_back();
+                window.emplace_back(i, weight);
+            }
+            while (ready + 1 <= i) {
+                int next = earliestEnd(ready + 1);
+                if (next < 0 || next > i + 1) break;
+                ready++;
+            }
+            while (!window.empty() && window.front().first <= ready) window.pop_front();
+
+            long long lightest = T + 1;
+            if (ready >= 0) lightest = prefix[i + 1] - prefix[ready];
+            if (!window.empty()) lightest = min(lightest, window.front().second);
+            if (lightest > T) {
+                throw runtime_error("No block at the optimal makespan holds job " + to_string(i));
+            }
+            report.slack[i] = T - lightest;
+        }
+
+        report.critical_ranges.clear();
+        for (int i = 0; i < n; i++) {
+            if (report.slack[i] != 0) continue;
+            report.critical_jobs++;
+            if (!report.critical_ranges.empty() && report.critical_ranges.back() == i) {
+                report.critical_ranges.back() = i + 1;
+            } else {
+                report.critical_ranges.push_back(i);
+                report.critical_ranges.push_back(i + 1);
+            }
+        }
+        report.makespan = T;
+        report.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        report.status = "invalid_input";
+        std::cerr << "Sensitivity input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        report.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    report.solve_time = duration<double>(end_time - start_time).count();
+    return report;
+}
@@ -0,0 +1,255 @@
+#include "models/stable_partition.hpp"
+#include "models/prefix_partition.hpp"
+#include "models/pseudo_polynomial.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+StableRepartition StablePartitionSolver::solve(const std::vector<int>& times, int m,
+                                               const std::vector<int>& previous_split_points,
+                                               const std::vector<int>& machine_map,
+                                               long long max_increase, bool is_test_mode) {
+    StableRepartition result;
+    auto start_time = high_resolution_clock::now();
+
+    std::string error_msg;
+    if (!validateInput(times, m, error_msg, is_test_mode)) {
+        result.status = "invalid_input";
+        std::cerr << "Stable repartition input error: " << error_msg << std::endl;
+        return result;
+    }
+
+    try {
+        if (max_increase < 0) {
+            throw invalid_argument("max_increase must be non-negative (" + to_string(max_increase) + ")");
+        }
+        const int n = static_cast<int>(times.size());
+
+        const int previous_m = static_cast<int>(previous_split_points.size()) - 1;
+        if (previous_m < 1 || previous_split_points.front() != 0 || previous_split_points.back() != n) {
+            throw invalid_argument("Previous split points must run from 0 to n=" + to_string(n));
+        }
+        for (int k = 0; k < previous_m; k++) {
+            if (previous_split_points[k] > previous_split_points[k + 1]) {
+                throw invalid_argument("Previous split points decrease at block " + to_string(k));
+            }
+        }
+
+        std::vector<int> map = machine_map;
+        if (map.empty()) {
+            for (int k = 0; k < m; k++) map.push_back(k < previous_m ? k : -1);
+        }
+        if (static_cast<int>(map.size()) != m) {
+            throw invalid_argument("Expected " + to_string(m) + " machine map entries, got " +
+                                   to_string(map.size()));
+        }
+        kept_start_.assign(m, 0);
+        kept_end_.assign(m, 0);
+        dropped_jobs_ = n;
+        int last_kept = -1;
+        for (int k = 0; k < m; k++) {
+            if (map[k] < 0) continue;
+            if (map[k] >= previous_m || map[k] <= last_kept) {
+                throw invalid_argument("Machine map entry " + to_string(map[k]) + " at block " +
+                                       to_string(k) + " is out of range or out of chain order");
+            }
+            last_kept = map[k];
+            kept_start_[k] = previous_split_points[map[k]];
+            kept_end_[k] = previous_split_points[map[k] + 1];
+            dropped_jobs_ -= kept_end_[k] - kept_start_[k];
+        }
+
+        // T* by parametric search: each probe snaps to the largest block
+        // (feasible) or the smallest block plus its next job
+        PrefixPartition::buildPrefixSums(times, prefix_);
+        const long long max_time = *max_element(times.begin(), times.end());
+        long long left = max(max_time, (prefix_.back() + m - 1) / m);
+        long long right = left + max_time;
+        while (left < right) {
+            long long middle = left + (right - left) / 2;
+            long long candidate = 0;
+            result.feasibility_checks++;
+            if (PrefixPartition::probeCandidate(prefix_, middle, m, candidate)) {
+                right = candidate;
+            } else {
+                left = candidate;
+            }
+        }
+        result.optimal_makespan = right;
+        const long long T = right + max_increase;
+
+        // Boundary k of any partition at T lies in [first_[k], last_[k]]
+        first_.assign(m + 1, n);
+        last_.assign(m + 1, 0);
+        for (int k = 1; k <= m; k++) {
+            last_[k] = PrefixPartition::nextBoundary(prefix_, last_[k - 1], T);
+        }
+        for (int k = m - 1; k >= 0; k--) {
+            long long reach = prefix_[first_[k + 1]] - T;
+            first_[k] = static_cast<int>(lower_bound(prefix_.begin(), prefix_.begin() + first_[k + 1], reach) -
+                                         prefix_.begin());
+        }
+        first_[0] = 0;
+        last_[m] = n;
+
+        // Cheap feasible partitions bound the optimum from above: every boundary
+        // placed at its cheapest position next to the previous one, left to
+        // right and right to left. The cheapest position of each boundary in its
+        // window bounds it from below, so boundary k only needs the positions
+        // costing at most its minimum plus (upper - lower).
+        std::vector<int> forward(m + 1, 0);
+        std::vector<int> backward(m + 1, n);
+        forward[m] = n;
+        backward[0] = 0;
+        for (int k = 1; k < m; k++) {
+            int low = max(first_[k], forward[k - 1]);
+            int high = min(last_[k], PrefixPartition::nextBoundary(prefix_, forward[k - 1], T));
+            forward[k] = cheapest(k, low, high);
+        }
+        for (int k = m - 1; k > 0; k--) {
+            long long reach = prefix_[backward[k + 1]] - T;
+            int low = static_cast<int>(lower_bound(prefix_.begin(), prefix_.begin() + backward[k + 1], reach) -
+                                       prefix_.begin());
+            backward[k] = cheapest(k, max(first_[k], low), min(last_[k], backward[k + 1]));
+        }
+        std::vector<int> greedy;
+        PrefixPartition::greedySplitPoints(prefix_, result.optimal_makespan, greedy);
+        greedy.resize(m + 1, n);
+        result.resolve_jobs_moved = movedJobs(greedy);
+        long long upper = min(result.resolve_jobs_moved, min(movedJobs(forward), movedJobs(backward)));
+        long long lower = dropped_jobs_;
+        std::vector<long long> least(m + 1, 0);
+        for (int k = 1; k < m; k++) {
+            least[k] = boundaryCost(k, cheapest(k, first_[k], last_[k]));
+            lower += least[k];
+        }
+        for (int k = 1; k < m; k++) {
+            trim(k, least[k] + (upper - lower));
+        }
+
+        // cost[s - first_[k]]: fewest jobs moved by boundaries 1..k with boundary k at s
+        offset_.assign(m + 2, 0);
+        for (int k = 0; k <= m; k++) {
+            offset_[k + 1] = offset_[k] + (last_[k] - first_[k] + 1);
+        }
+        parent_.assign(offset_[m + 1], -1);
+        std::vector<long long> previous(1, 0);
+        std::vector<long long> cost;
+        std::deque<int> window;                 // Boundaries k - 1, costs increasing
+        for (int k = 1; k <= m; k++) {
+            cost.assign(last_[k] - first_[k] + 1, LLONG_MAX);
+            window.clear();
+            int pushed = first_[k - 1];
+            int lowest = first_[k - 1];
+            for (int s = first_[k]; s <= last_[k]; s++) {
+                while (pushed <= min(last_[k - 1], s)) {
+                    long long value = previous[pushed - first_[k - 1]];
+                    if (value != LLONG_MAX) {
+                        while (!window.empty() && previous[window.back() - first_[k - 1]] >= value) {
+                            window.pop_back();
+                        }
+                        window.push_back(pushed);
+                    }
+                    pushed++;
+                }
+                while (lowest < s && prefix_[s] - prefix_[lowest] > T) lowest++;
+                while (!window.empty() && window.front() < lowest) window.pop_front();
+                if (window.empty()) continue;
+                cost[s - first_[k]] = previous[window.front() - first_[k - 1]] + boundaryCost(k, s);
+                parent_[offset_[k] + s - first_[k]] = window.front();
+            }
+            previous.swap(cost);
+        }
+        if (previous.back() == LLONG_MAX) {
+            throw runtime_error("No partition within makespan " + to_string(T));
+        }
+
+        result.split_points.assign(m + 1, n);
+        for (int k = m; k > 0; k--) {
+            result.split_points[k - 1] = parent_[offset_[k] + result.split_points[k] - first_[k]];
+        }
+        result.jobs_moved = dropped_jobs_ + previous.back();
+        PrefixPartition::blockLoads(prefix_, result.split_points, result.machine_loads);
+        result.makespan = *max_element(result.machine_loads.begin(), result.machine_loads.end());
+        result.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        result.status = "invalid_input";
+        std::cerr << "Stable repartition input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.status = string("error: ") + e.what();
+    }
+
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+long long StablePartitionSolver::boundaryCost(int k, int position) const {
+    // Jobs of block k - 1's previous block past the boundary, and of block k's
+    // previous block before it
+    long long cost = 0;
+    if (k > 0) {
+        cost += max(0, kept_end_[k - 1] - max(position, kept_start_[k - 1]));
+    }
+    if (k < static_cast<int>(kept_start_.size())) {
+        cost += max(0, min(position, kept_end_[k]) - kept_start_[k]);
+    }
+    return cost;
+}
+
+int StablePartitionSolver::cheapest(int k, int low, int high) const {
+    // The cost is piecewise linear, so its minimum over [low, high] sits at an
+    // end or at an end of a previous block
+    const int points[6] = {low, high, kept_start_[k - 1], kept_end_[k - 1], kept_start_[k], kept_end_[k]};
+    int best = low;
+    for (int point : points) {
+        int position = min(max(point, low), high);
+        long long cost = boundaryCost(k, position);
+        long long best_cost = boundaryCost(k, best);
+        if (cost < best_cost || (cost == best_cost && position < best)) best = position;
+    }
+    return best;
+}
+
+void StablePartitionSolver::trim(int k, long long budget) {
+    // The cost falls to its minimum and rises after it, since the previous
+    // blocks of boundaries k - 1 and k are in chain order
+    const int middle = cheapest(k, first_[k], last_[k]);
+    int low = first_[k];
+    int high = middle;
+    while (low < high) {
+        int probe = low + (high - low) / 2;
+        if (boundaryCost(k, probe) <= budget) {
+            high = probe;
+        } else {
+            low = probe + 1;
+        }
+    }
+    first_[k] = low;
+    low = middle;
+    high = last_[k];
+    while (low < high) {
+        int probe = high - (high - low) / 2;
+        if (boundaryCost(k, probe) <= budget) {
+            low = probe;
+        } else {
+            high = probe - 1;
+        }
+    }
+    last_[k] = high;
+}
+
+long long StablePartitionSolver::movedJobs(const std::vector<int>& split_points) const {
+    long long moved = dropped_jobs_;
+    for (size_t k = 1; k + 1 < split_points.size(); k++) {
+        moved += boundaryCost(static_cast<int>(k), split_points[k]);
+    }
+    return moved;
+}
@@ -0,0 +1,256 @@
+#include "models/streaming_solver.hpp"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+using namespace std::chrono;
+
+namespace {
+
+    // Boundaries recorded during a sweep are capped at this many entries; above it
+    // the winning threshold gets one more recording pass of its own
+    const long long kRecordBudget = 1LL << 22;
+
+    // Reads positive integers separated by whitespace or commas, one chunk at a
+    // time. Every chunk read can be copied to a spool file as it goes.
+    class ChunkReader {
+    public:
+        ChunkReader(FILE* file, size_t chunk_bytes, FILE* spool = nullptr)
+            : file_(file), spool_(spool), buffer_(max<size_t>(chunk_bytes, 64)) {}
+
+        // False at the end of the stream; throws on anything but digits and separators
+        bool next(int& value) {
+            int c = skipSeparators();
+            if (c < 0) return false;
+
+            long long number = 0;
+            while (c >= '0' && c <= '9') {
+                number = number * 10 + (c - '0');
+                if (number > INT_MAX) {
+                    throw runtime_error("Processing time out of range in job stream");
+                }
+                pos_++;
+                c = peek();
+            }
+            if (c >= 0 && !isSeparator(c)) {
+                throw runtime_error(string("Unexpected character '") + static_cast<char>(c) +
+                                    "' in job stream");
+            }
+            value = static_cast<int>(number);
+            return true;
+        }
+
+    private:
+        FILE* file_;
+        FILE* spool_;
+        vector<char> buffer_;
+        size_t pos_ = 0;
+        size_t size_ = 0;
+
+        static bool isSeparator(int c) {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == ',';
+        }
+
+        int peek() {
+            if (pos_ == size_) {
+                size_ = fread(buffer_.data(), 1, buffer_.size(), file_);
+                pos_ = 0;
+                if (size_ == 0) {
+                    if (ferror(file_)) throw runtime_error("Read error in job stream");
+                    return -1;
+                }
+                if (spool_ && fwrite(buffer_.data(), 1, size_, spool_) != size_) {
+                    throw runtime_error("Could not spool job stream to a temporary file");
+                }
+            }
+            return static_cast<unsigned char>(buffer_[pos_]);
+        }
+
+        int skipSeparators() {
+            int c = peek();
+            while (c >= 0 && isSeparator(c)) {
+                pos_++;
+                c = peek();
+            }
+            return c;
+        }
+    };
+}
+
+StreamingSolution StreamingSolver::solve(const std::string& path, int m) {
+    if (path == "-") {
+        return solve(stdin, m);
+    }
+
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        StreamingSolution result;
+        result.status = "error: could not open " + path;
+        std::cerr << "Streaming input error: could not open " << path << std::endl;
+        return result;
+    }
+    StreamingSolution result = solve(file, m);
+    fclose(file);
+    return result;
+}
+
+StreamingSolution StreamingSolver::solve(std::FILE* input, int m) {
+    StreamingSolution result;
+    auto start_time = high_resolution_clock::now();
+    FILE* spool = nullptr;
+
+    try {
+        if (m < 1) {
+            throw invalid_argument("m must be positive (m=" + to_string(m) + ")");
+        }
+
+        // Pass 1: n, total and longest job. A stream that cannot be rewound is
+        // copied to a temporary file on the way.
+        if (fseek(input, 0, SEEK_CUR) != 0) {
+            spool = tmpfile();
+            if (!spool) throw runtime_error("Could not create a temporary spool file");
+        }
+
+        long long n = 0;
+        long long total = 0;
+        int max_time = 0;
+        ChunkReader reader(input, chunk_bytes_, spool);
+        for (int t; reader.next(t); n++) {
+            if (t < 1) {
+                throw invalid_argument("Processing time at index " + to_string(n) +
+                                       " is " + to_string(t) + ", must be positive");
+            }
+            total += t;
+            max_time = max(max_time, t);
+        }
+        result.passes = 1;
+        result.number_of_jobs = n;
+
+        if (n <= m) {
+            throw invalid_argument("n must be greater than m (n=" + to_string(n) +
+                                   ", m=" + to_string(m) + ")");
+        }
+
+        FILE* data = spool ? spool : input;
+
+        // T* lies in [left, right] and right is always feasible (see PseudoPolynomialSolver)
+        long long average = (total + m - 1) / m;
+        long long left = max<long long>(max_time, average);
+        long long right = min(total, average + max_time);
+
+        vector<Lane> lanes;
+        bool recorded = false;
+
+        while (left < right) {
+            long long width = right - left + 1;
+            bool exhaustive = width <= kMaxLanes;
+
+            lanes.clear();
+            if (exhaustive) {
+                for (long long T = left; T <= right; T++) lanes.push_back(Lane{T});
+            } else {
+                for (int lane = 1; lane <= kMaxLanes; lane++) {
+                    long long T = left + (right - left) * lane / (kMaxLanes + 1);
+                    if (lanes.empty() || T > lanes.back().T) lanes.push_back(Lane{T});
+                }
+            }
+
+            bool record = exhaustive && width * m <= kRecordBudget;
+            sweep(data, lanes, m, record);
+            result.passes++;
+
+            if (exhaustive) {
+                // The smallest feasible lane is T*; right itself is always feasible
+                auto best = find_if(lanes.begin(), lanes.end(),
+                                    [](const Lane& lane) { return lane.feasible; });
+                left = right = best->T;
+                if (record) {
+                    swap(lanes.front(), *best);
+                    lanes.resize(1);
+                    recorded = true;
+                }
+                break;
+            }
+
+            // Snap onto candidate makespans exactly as the in-memory search does
+            for (const Lane& lane : lanes) {
+                if (lane.feasible) {
+                    right = min(right, lane.max_load);
+                } else {
+                    left = max(left, lane.next_candidate);
+                }
+            }
+        }
+
+        if (!recorded) {
+            lanes.assign(1, Lane{left});
+            sweep(data, lanes, m, true);
+            result.passes++;
+        }
+
+        const Lane& best = lanes.front();
+        result.makespan = static_cast<double>(best.T);
+        result.split_points.reserve(best.ends.size() + 1);
+        result.split_points.push_back(0);
+        result.split_points.insert(result.split_points.end(), best.ends.begin(), best.ends.end());
+        result.machine_loads = best.loads;
+        result.status = "optimal";
+
+    } catch (const invalid_argument& e) {
+        result.status = "invalid_input";
+        std::cerr << "Streaming input error: " << e.what() << std::endl;
+    } catch (const exception& e) {
+        result.status = string("error: ") + e.what();
+    }
+
+    if (spool) fclose(spool);
+    auto end_time = high_resolution_clock::now();
+    result.solve_time = duration<double>(end_time - start_time).count();
+    return result;
+}
+
+void StreamingSolver::sweep(std::FILE* data, std::vector<Lane>& lanes, int m, bool record) const {
+    rewind(data);
+    ChunkReader reader(data, chunk_bytes_);
+
+    size_t active = lanes.size();
+    long long index = 0;
+    for (int t; active > 0 && reader.next(t); index++) {
+        for (Lane& lane : lanes) {
+            if (!lane.feasible) continue;
+            if (lane.load + t <= lane.T) {
+                lane.load += t;
+                continue;
+            }
+
+            // Job `index` opens a new block; every lane has T >= max t, so the
+            // open block is never empty here
+            long long grown = lane.load + t;
+            if (lane.next_candidate < 0 || grown < lane.next_candidate) lane.next_candidate = grown;
+            if (lane.blocks == m) {
+                lane.feasible = false;
+                active--;
+                continue;
+            }
+            lane.max_load = max(lane.max_load, lane.load);
+            if (record) {
+                lane.ends.push_back(index);
+                lane.loads.push_back(lane.load);
+            }
+            lane.blocks++;
+            lane.load = t;
+        }
+    }
+
+    for (Lane& lane : lanes) {
+        if (!lane.feasible) continue;
+        lane.max_load = max(lane.max_load, lane.load);
+        if (record) {
+            lane.ends.push_back(index);
+            lane.loads.push_back(lane.load);
+        }
+    }
+}
@@ -0,0 +1,175 @@
+#include "models/pseudo_polynomial.hpp"
+#include "models/linear_partition.hpp"
+#include "models/packed_kernels.hpp"
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+
+// ============================================
+// ENGINE BENCHMARK (STANDALONE TOOL)
+// ============================================
+
+namespace {
+
+    std::vector<int> random_times(int n, std::mt19937& gen) {
+        std::uniform_int_distribution<> distrib(1, 24);
+        std::vector<int> times(n);
+        for (int i = 0; i < n; i++) {
+            times[i] = distrib(gen);
+        }
+        return times;
+    }
+
+    const int kSmallSolves = 1000;
+
+    // Solves the same instance kSmallSolves times on one solver (the allocation-free
+    // path) and reports the last solution with the summed solve time
+    PseudoPolySolution solve_repeatedly(const PseudoPolyOptions& options,
+                                        const std::vector<int>& times, int m) {
+        PseudoPolynomialSolver solver(options);
+        PseudoPolySolution sol;
+        double total_time = 0.0;
+        for (int run = 0; run < kSmallSolves; run++) {
+            solver.solve(times, m, sol, true);
+            total_time += sol.solve_time;
+        }
+        sol.solve_time = total_time;
+        return sol;
+    }
+
+    void print_row(const std::string& engine, int n, int m, const PseudoPolySolution& sol) {
+        std::cout << std::left << std::setw(14) << engine
+                  << std::right << std::setw(10) << n
+                  << std::setw(8) << m
+                  << std::setw(12) << std::fixed << std::setprecision(0) << sol.makespan
+                  << std::setw(8) << sol.feasibility_checks
+                  << std::setw(14) << std::scientific << std::setprecision(3) << sol.solve_time
+                  << std::endl;
+    }
+
+}
+
+int main() {
+    std::cout << "==========================================" << std::endl;
+    std::cout << "  ENGINE BENCHMARK" << std::endl;
+    std::cout << "==========================================" << std::endl;
+    
+    std::mt19937 gen(2024);
+    const std::vector<int> job_counts = {1000, 10000, 100000, 1000000, 10000000};
+    const int m = 16;
+    
+    std::cout << "\n--- Linear-time engine vs bisection ---" << std::endl;
+    std::cout << std::left << std::setw(14) << "Engine"
+              << std::right << std::setw(10) << "n"
+              << std::setw(8) << "m"
+              << std::setw(12) << "Makespan"
+              << std::setw(8) << "Checks"
+              << std::setw(14) << "Time (s)" << std::endl;
+    
+    PseudoPolyOptions bisection;
+    bisection.search_mode = SearchMode::Bisection;
+    
+    for (int n : job_counts) {
+        std::vector<int> times = random_times(n, gen);
+        
+        PseudoPolySolution bisect_sol = PseudoPolynomialSolver(bisection).solve(times, m, true);
+        PseudoPolySolution linear_sol = LinearPartitionSolver().solve(times, m, true);
+        
+        print_row("bisection", n, m, bisect_sol);
+        print_row("linear", n, m, linear_sol);
+        
+        if (bisect_sol.makespan != linear_sol.makespan) {
+            std::cerr << "✗ Makespan mismatch for n=" << n << std::endl;
+            return 1;
+        }
+    }
+    
+    std::cout << "\n--- Probe kernels (m = n / 50, AVX2 "
+              << (PackedKernels::hasAvx2() ? "on" : "off") << ") ---" << std::endl;
+    
+    PseudoPolyOptions jumps;
+    jumps.probe_kernel = ProbeKernel::PrefixJumps;
+    PseudoPolyOptions packed;
+    packed.probe_kernel = ProbeKernel::PackedScan;
+    
+    for (int n : job_counts) {
+        std::vector<int> times = random_times(n, gen);
+        int many = n / 50;
+        
+        PseudoPolySolution jumps_sol = PseudoPolynomialSolver(jumps).solve(times, many, true);
+        PseudoPolySolution packed_sol = PseudoPolynomialSolver(packed).solve(times, many, true);
+        
+        print_row("prefix-jumps", n, many, jumps_sol);
+        print_row("packed-scan", n, many, packed_sol);
+        
+        if (jumps_sol.makespan != packed_sol.makespan) {
+            std::cerr << "✗ Makespan mismatch for n=" << n << std::endl;
+            return 1;
+        }
+    }
+    
+    std::cout << "\n--- Multi-threshold probes (packed scan, bisection bounds, m = 16) ---" << std::endl;
+    
+    for (int lanes : {1, 8}) {
+        PseudoPolyOptions options;
+        options.search_mode = SearchMode::Bisection;
+        options.probe_kernel = ProbeKernel::PackedScan;
+        options.probe_lanes = lanes;
+        
+        for (int n : job_counts) {
+            std::vector<int> times = random_times(n, gen);
+            PseudoPolySolution sol = PseudoPolynomialSolver(options).solve(times, m, true);
+            print_row(lanes == 1 ? "1-lane" : "8-lane", n, m, sol);
+        }
+    }
+    
+    std::cout << "\n--- Worker threads (n >= 10^6, m = 16) ---" << std::endl;
+    
+    for (int n : {1000000, 10000000}) {
+        std::vector<int> times = random_times(n, gen);
+        PseudoPolyOptions sequential;
+        PseudoPolyOptions parallel;
+        parallel.threads = 0;
+        parallel.parallel_min_jobs = 0;
+        
+        PseudoPolySolution seq_sol = PseudoPolynomialSolver(sequential).solve(times, m, true);
+        PseudoPolySolution par_sol = PseudoPolynomialSolver(parallel).solve(times, m, true);
+        
+        print_row("1-thread", n, m, seq_sol);
+        print_row("all-threads", n, m, par_sol);
+        
+        if (seq_sol.split_points != par_sol.split_points) {
+            std::cerr << "✗ Partition mismatch for n=" << n << std::endl;
+            return 1;
+        }
+    }
+    
+    std::cout << "\n--- Fixed-m kernels vs generic jumps (" << kSmallSolves
+              << " solves per row, total time) ---" << std::endl;
+    
+    PseudoPolyOptions generic;
+    generic.probe_kernel = ProbeKernel::PrefixJumps;
+    PseudoPolyOptions fixed;
+    fixed.probe_kernel = ProbeKernel::FixedM;
+    
+    for (int small_m : {2, 4, 8, 16}) {
+        for (int n : {1000, 100000}) {
+            std::vector<int> times = random_times(n, gen);
+            PseudoPolySolution generic_sol = solve_repeatedly(generic, times, small_m);
+            PseudoPolySolution fixed_sol = solve_repeatedly(fixed, times, small_m);
+            
+            print_row("generic", n, small_m, generic_sol);
+            print_row("fixed-m", n, small_m, fixed_sol);
+            
+            if (generic_sol.makespan != fixed_sol.makespan ||
+                generic_sol.split_points != fixed_sol.split_points) {
+                std::cerr << "✗ Fixed-m mismatch for n=" << n << ", m=" << small_m << std::endl;
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
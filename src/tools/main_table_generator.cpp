@@ -26,6 +26,7 @@ int main() {
         
         std::cout << "\n[2/3] Generating console table..." << std::endl;
         TableGenerator::printConsoleTable(results);
+        TableGenerator::printFreeOrderTable(results);
         
         std::cout << "\n[3/3] Generating output files..." << std::endl;
         TableGenerator::generateLatexTable(results, latex_output);
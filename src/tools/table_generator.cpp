@@ -283,6 +283,14 @@ vector<ResultData> TableGenerator::readResultsFromDirectory(const string& direct
                     rd.status_milp = (rd.ms_milp >= 0) ? "feasible" : "failed";
                 }
                 
+                // Free-order heuristics are optional
+                rd.ms_lpt = TableGenerator::extractDoubleInSection(json_str, "free_order/lpt/makespan");
+                rd.ms_multifit = TableGenerator::extractDoubleInSection(json_str, "free_order/multifit/makespan");
+                rd.ms_kk = TableGenerator::extractDoubleInSection(json_str, "free_order/karmarkar_karp/makespan");
+                rd.gap_lpt = TableGenerator::extractDoubleInSection(json_str, "free_order/lpt/gap");
+                rd.gap_multifit = TableGenerator::extractDoubleInSection(json_str, "free_order/multifit/gap");
+                rd.gap_kk = TableGenerator::extractDoubleInSection(json_str, "free_order/karmarkar_karp/gap");
+                
                 if (rd.status_pseudo.empty()) {
                     rd.status_pseudo = (rd.ms_pseudo >= 0) ? "optimal" : "failed";
                 }
@@ -551,6 +559,31 @@ void TableGenerator::generateStatistics(const vector<ResultData>& results,
              << fixed << setprecision(1) << (count * 100.0 / results.size()) << "%)\n";
     }
     
+    // Free-order heuristics: mean gap to the lower bound and how often it is met
+    const vector<pair<string, pair<double ResultData::*, double ResultData::*>>> heuristics = {
+        {"LPT", {&ResultData::ms_lpt, &ResultData::gap_lpt}},
+        {"MULTIFIT", {&ResultData::ms_multifit, &ResultData::gap_multifit}},
+        {"Karmarkar-Karp", {&ResultData::ms_kk, &ResultData::gap_kk}}
+    };
+    file << "\n--- Free-order Heuristics (gap to max(max t, ceil(sum/m))) ---\n";
+    for (const auto& [label, fields] : heuristics) {
+        int runs = 0;
+        int at_bound = 0;
+        double gap_sum = 0.0;
+        for (const auto& rd : results) {
+            if (rd.*fields.first < 0) continue;
+            runs++;
+            gap_sum += rd.*fields.second;
+            if (rd.*fields.second == 0.0) at_bound++;
+        }
+        if (runs == 0) {
+            file << label << ": no data\n";
+            continue;
+        }
+        file << label << ": average gap " << fixed << setprecision(3) << (gap_sum * 100.0 / runs)
+             << "%, at lower bound " << at_bound << "/" << runs << "\n";
+    }
+    
     file << "\n--- Problem Size Range ---\n";
     int min_n = numeric_limits<int>::max();
     int max_n = 0;
@@ -726,4 +759,55 @@ void TableGenerator::printConsoleTable(const vector<ResultData>& results) {
         }
         cout << ")" << endl;
     }
-}
\ No newline at end of file
+}
+
+void TableGenerator::printFreeOrderTable(const vector<ResultData>& results) {
+    vector<const ResultData*> rows;
+    for (const auto& rd : results) {
+        if (rd.ms_lpt >= 0 || rd.ms_multifit >= 0 || rd.ms_kk >= 0) rows.push_back(&rd);
+    }
+    if (rows.empty()) {
+        cout << "No free-order heuristic results to display." << endl;
+        return;
+    }
+    
+    cout << "\n" << string(90, '=') << endl;
+    cout << "FREE-ORDER HEURISTICS (gap to max(max t, ceil(sum/m)))" << endl;
+    cout << string(90, '=') << endl;
+    cout << left
+              << setw(6) << "n"
+              << setw(6) << "m"
+              << setw(12) << "Pseudo_ms"
+              << setw(10) << "LPT"
+              << setw(10) << "Gap(%)"
+              << setw(10) << "MULTIFIT"
+              << setw(10) << "Gap(%)"
+              << setw(10) << "KK"
+              << setw(10) << "Gap(%)"
+              << endl;
+    cout << string(90, '-') << endl;
+    
+    auto cell = [](double makespan, double gap) {
+        if (makespan >= 0) {
+            cout << setw(10) << fixed << setprecision(0) << makespan
+                 << setw(10) << fixed << setprecision(3) << (gap * 100);
+        } else {
+            cout << setw(10) << "---" << setw(10) << "---";
+        }
+    };
+    
+    for (const ResultData* rd : rows) {
+        cout << left << setw(6) << rd->n << setw(6) << rd->m;
+        if (rd->ms_pseudo >= 0) {
+            cout << setw(12) << fixed << setprecision(0) << rd->ms_pseudo;
+        } else {
+            cout << setw(12) << "---";
+        }
+        cell(rd->ms_lpt, rd->gap_lpt);
+        cell(rd->ms_multifit, rd->gap_multifit);
+        cell(rd->ms_kk, rd->gap_kk);
+        cout << endl;
+    }
+    
+    cout << string(90, '=') << endl;
+}
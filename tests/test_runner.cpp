@@ -2,8 +2,26 @@
 #include <iomanip>
 #include <cmath>
 #include <chrono>
+#include <cstdio>
+#include <algorithm>
+#include <climits>
 #include "models/milp_solver.hpp"
 #include "models/pseudo_polynomial.hpp"
+#include "models/linear_partition.hpp"
+#include "models/dp_solver.hpp"
+#include "models/dynamic_instance.hpp"
+#include "models/streaming_solver.hpp"
+#include "models/high_multiplicity.hpp"
+#include "models/free_order_heuristics.hpp"
+#include "models/heterogeneous_partition.hpp"
+#include "models/pipeline_partition.hpp"
+#include "models/circular_partition.hpp"
+#include "models/hierarchical_partition.hpp"
+#include "models/multi_resource_partition.hpp"
+#include "models/sensitivity.hpp"
+#include "models/partition_verifier.hpp"
+#include "models/stable_partition.hpp"
+#include "models/coarse_partition.hpp"
 #include "test_cases.hpp"
 
 void TestCase::print() const {
@@ -22,35 +40,276 @@ void print_solution(const std::string& method,
                    double makespan, 
                    double solve_time,
                    const std::vector<int>& times,
-                   const std::map<int, std::vector<int>>& assignments) {
+                   const std::vector<int>& split_points) {
     std::cout << "\n" << method << " Results:" << std::endl;
     std::cout << "Makespan: " << makespan << std::endl;
     std::cout << "Solve time: " << std::fixed << std::setprecision(6) 
               << solve_time << " seconds" << std::endl;
     
     std::cout << "Job Assignments:" << std::endl;
-    for (const auto& [machine, jobs] : assignments) {
-        std::cout << "  Machine " << machine << ": jobs [";
-        
-        // Print job indices
-        for (size_t i = 0; i < jobs.size(); i++) {
-            std::cout << jobs[i];
-            if (i < jobs.size() - 1) std::cout << ", ";
-        }
-        std::cout << "], times [";
+    for (size_t machine = 0; machine + 1 < split_points.size(); machine++) {
+        std::cout << "  Machine " << machine << ": jobs [" << split_points[machine]
+                  << ", " << split_points[machine + 1] << "), times [";
         
         // Print processing times and calculate total
-        int total = 0;
-        for (size_t i = 0; i < jobs.size(); i++) {
-            int job_time = times[jobs[i]];
-            std::cout << job_time;
-            total += job_time;
-            if (i < jobs.size() - 1) std::cout << ", ";
+        long long total = 0;
+        for (int job = split_points[machine]; job < split_points[machine + 1]; job++) {
+            std::cout << times[job];
+            total += times[job];
+            if (job + 1 < split_points[machine + 1]) std::cout << ", ";
         }
         std::cout << "], total: " << total << std::endl;
     }
 }
 
+// Split points must run from 0 to n in increasing order with at most m blocks
+bool valid_split_points(const std::vector<int>& split_points, int n, int m) {
+    if (split_points.size() < 2 || static_cast<int>(split_points.size()) - 1 > m) return false;
+    if (split_points.front() != 0 || split_points.back() != n) return false;
+    for (size_t k = 0; k + 1 < split_points.size(); k++) {
+        if (split_points[k] >= split_points[k + 1]) return false;
+    }
+    return true;
+}
+
+// Check an alternative engine against the expected makespan
+bool check_engine(const std::string& engine, const PseudoPolySolution& sol, const TestCase& tc) {
+    double expected = tc.expected_makespan;
+    if (sol.status != "optimal") {
+        std::cout << "✗ FAIL: " << engine << " status " << sol.status << std::endl;
+        return false;
+    }
+    if (!valid_split_points(sol.split_points, static_cast<int>(tc.times.size()), tc.m)) {
+        std::cout << "✗ FAIL: " << engine << " returned malformed split points" << std::endl;
+        return false;
+    }
+    if (std::abs(sol.makespan - expected) > 0.0) {
+        std::cout << "✗ FAIL: " << engine << " makespan " << sol.makespan
+                  << ", expected " << expected << std::endl;
+        return false;
+    }
+    std::cout << "✓ PASS: " << engine << " makespan " << sol.makespan
+              << " (" << sol.feasibility_checks << " checks)" << std::endl;
+    return true;
+}
+
+// Exact two-level optimum by exhaustive DP over node and core boundaries, for
+// small chains. A node's first core pays the transfer unless the node starts the
+// chain, its last core unless it ends it; nodes left over stay empty.
+long long brute_force_nested(const std::vector<int>& times, int nodes, int cores, long long cost) {
+    const int n = static_cast<int>(times.size());
+    const long long unreachable = LLONG_MAX / 4;
+    std::vector<long long> prefix(n + 1, 0);
+    for (int i = 0; i < n; i++) prefix[i + 1] = prefix[i] + times[i];
+    
+    // node_load[i][j]: best bottleneck of [i, j) over the cores of one node
+    std::vector<std::vector<long long>> node_load(n + 1, std::vector<long long>(n + 1, unreachable));
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j <= n; j++) {
+            std::vector<long long> best(j + 1, unreachable);  // First c cores ending at p
+            best[i] = 0;
+            for (int core = 0; core < cores; core++) {
+                long long extra = (core == 0 && i > 0 ? cost : 0) + (core == cores - 1 && j < n ? cost : 0);
+                std::vector<long long> next(j + 1, unreachable);
+                for (int p = i; p <= j; p++) {
+                    for (int q = i; q <= p; q++) {
+                        next[p] = std::min(next[p], std::max(best[q], prefix[p] - prefix[q] + extra));
+                    }
+                }
+                best.swap(next);
+            }
+            node_load[i][j] = best[j];
+        }
+    }
+    
+    std::vector<long long> reach(n + 1, unreachable);  // Used nodes so far covering [0, j)
+    reach[0] = 0;
+    long long answer = unreachable;
+    for (int node = 0; node < nodes; node++) {
+        std::vector<long long> next(n + 1, unreachable);
+        for (int j = 1; j <= n; j++) {
+            for (int i = 0; i < j; i++) {
+                next[j] = std::min(next[j], std::max(reach[i], node_load[i][j]));
+            }
+        }
+        reach.swap(next);
+        answer = std::min(answer, reach[n]);
+    }
+    return answer;
+}
+
+// Smallest wall-clock makespan over machines of the given speeds in chain order,
+// by exhaustive DP; blocks may be empty, so slow machines can stay idle
+double brute_force_speeds(const std::vector<int>& times, const std::vector<double>& speeds) {
+    const int n = static_cast<int>(times.size());
+    std::vector<long long> prefix(n + 1, 0);
+    for (int i = 0; i < n; i++) prefix[i + 1] = prefix[i] + times[i];
+    
+    std::vector<double> best(n + 1, HUGE_VAL);  // Machines so far covering [0, p)
+    best[0] = 0.0;
+    for (double speed : speeds) {
+        std::vector<double> next(n + 1, HUGE_VAL);
+        for (int p = 0; p <= n; p++) {
+            for (int q = 0; q <= p; q++) {
+                next[p] = std::min(next[p], std::max(best[q], (prefix[p] - prefix[q]) / speed));
+            }
+        }
+        best.swap(next);
+    }
+    return best[n];
+}
+
+// Smallest largest score max_r load_r / capacities[r] over at most m non-empty
+// blocks, by exhaustive DP
+double brute_force_resources(const std::vector<std::vector<int>>& resources, int m,
+                             const std::vector<long long>& capacities) {
+    const int n = static_cast<int>(resources[0].size());
+    auto score = [&](int begin, int end) {
+        double largest = 0.0;
+        for (size_t r = 0; r < resources.size(); r++) {
+            long long load = 0;
+            for (int j = begin; j < end; j++) load += resources[r][j];
+            largest = std::max(largest, static_cast<double>(load) / capacities[r]);
+        }
+        return largest;
+    };
+    
+    std::vector<double> best(n + 1, HUGE_VAL);  // Blocks so far covering [0, p)
+    best[0] = 0.0;
+    double answer = HUGE_VAL;
+    for (int block = 0; block < m; block++) {
+        std::vector<double> next(n + 1, HUGE_VAL);
+        for (int p = 1; p <= n; p++) {
+            for (int q = 0; q < p; q++) {
+                next[p] = std::min(next[p], std::max(best[q], score(q, p)));
+            }
+        }
+        best.swap(next);
+        answer = std::min(answer, best[n]);
+    }
+    return answer;
+}
+
+// Smallest bottleneck stage over at most m stages, a stage [a, b] paying
+// comm[a - 1] and comm[b] at its chain-internal ends, by exhaustive DP
+long long brute_force_pipeline(const std::vector<int>& times, const std::vector<int>& comm, int m) {
+    const int n = static_cast<int>(times.size());
+    const long long unreachable = LLONG_MAX / 4;
+    std::vector<long long> prefix(n + 1, 0);
+    for (int i = 0; i < n; i++) prefix[i + 1] = prefix[i] + times[i];
+    
+    std::vector<long long> best(n + 1, unreachable);  // Stages so far covering [0, p)
+    best[0] = 0;
+    long long answer = unreachable;
+    for (int stage = 0; stage < m; stage++) {
+        std::vector<long long> next(n + 1, unreachable);
+        for (int p = 1; p <= n; p++) {
+            for (int q = 0; q < p; q++) {
+                long long cost = prefix[p] - prefix[q] + (q > 0 ? comm[q - 1] : 0) +
+                                 (p < n ? comm[p - 1] : 0);
+                next[p] = std::min(next[p], std::max(best[q], cost));
+            }
+        }
+        best.swap(next);
+        answer = std::min(answer, best[n]);
+    }
+    return answer;
+}
+
+// Pipeline mapping where greedy furthest reach fails: times {1, 1, 1, 4}, comm
+// {0, 1, 3}, two stages. At T = 6 the furthest first stage [0, 2] costs 3 + 3
+// and leaves [3] at 4 + 3 = 7, while [0] and [1, 3] cost 1 and 6 + 0.
+bool run_pipeline_example() {
+    std::cout << "\n" << std::string(70, '=') << std::endl;
+    std::cout << "RUNNING TEST: Pipeline mapping by hand" << std::endl;
+    
+    PipelinePartitionSolver pipeline_solver;
+    PseudoPolySolution staged = pipeline_solver.solve({1, 1, 1, 4}, {0, 1, 3}, 2, true);
+    bool passed = staged.status == "optimal" && staged.makespan == 6.0 &&
+                  staged.split_points == std::vector<int>{0, 1, 4} &&
+                  staged.machine_loads == std::vector<long long>{1, 6} &&
+                  !pipeline_solver.isFeasible(5, 2);
+    if (!passed) {
+        std::cout << "✗ FAIL: Pipeline makespan " << staged.makespan << ", expected 6" << std::endl;
+    } else {
+        std::cout << "✓ PASS: Pipeline makespan 6 with stages [0] and [1, 3]" << std::endl;
+    }
+    std::cout << std::string(70, '=') << std::endl;
+    return passed;
+}
+
+// Jobs that new block k keeps from previous block machine_map[k]
+long long kept_jobs(const std::vector<int>& split_points, const std::vector<int>& previous,
+                    const std::vector<int>& machine_map) {
+    long long kept = 0;
+    for (size_t k = 0; k < machine_map.size(); k++) {
+        if (machine_map[k] < 0) continue;
+        int begin = std::max(split_points[k], previous[machine_map[k]]);
+        int end = std::min(split_points[k + 1], previous[machine_map[k] + 1]);
+        kept += std::max(0, end - begin);
+    }
+    return kept;
+}
+
+// Fewest moved jobs over all partitions into machine_map.size() blocks, empty
+// ones allowed, with every block load at most T, by exhaustive DP; -1 if none
+long long brute_force_moved(const std::vector<int>& times, const std::vector<int>& previous,
+                            const std::vector<int>& machine_map, long long T) {
+    const int n = static_cast<int>(times.size());
+    std::vector<long long> prefix(n + 1, 0);
+    for (int i = 0; i < n; i++) prefix[i + 1] = prefix[i] + times[i];
+    
+    std::vector<long long> best(n + 1, -1);  // Most kept jobs with blocks so far covering [0, p)
+    best[0] = 0;
+    for (size_t k = 0; k < machine_map.size(); k++) {
+        std::vector<long long> next(n + 1, -1);
+        for (int p = 0; p <= n; p++) {
+            for (int q = 0; q <= p; q++) {
+                if (best[q] < 0 || prefix[p] - prefix[q] > T) continue;
+                long long kept = 0;
+                if (machine_map[k] >= 0) {
+                    int begin = std::max(q, previous[machine_map[k]]);
+                    int end = std::min(p, previous[machine_map[k] + 1]);
+                    kept = std::max(0, end - begin);
+                }
+                next[p] = std::max(next[p], best[q] + kept);
+            }
+        }
+        best.swap(next);
+    }
+    return best[n] < 0 ? -1 : n - best[n];
+}
+
+// Stable re-optimization on a chain small enough to check by hand: eight unit
+// jobs on machines [0, 1), [1, 5), [5, 7), [7, 8), and the last one fails. At
+// T* = 3 the blocks [0, 2), [2, 5), [5, 8) move only jobs 1 and 7, where the
+// greedy [0, 3), [3, 6), [6, 8) moves four; at T* + 1, [0, 1), [1, 5), [5, 8)
+// move job 7 alone.
+bool run_stable_example() {
+    std::cout << "\n" << std::string(70, '=') << std::endl;
+    std::cout << "RUNNING TEST: Stable re-optimization by hand" << std::endl;
+    
+    std::vector<int> times(8, 1);
+    std::vector<int> previous = {0, 1, 5, 7, 8};
+    std::vector<int> survivors = {0, 1, 2};
+    StablePartitionSolver stable_solver;
+    StableRepartition tight = stable_solver.solve(times, 3, previous, survivors, 0, true);
+    StableRepartition slack = stable_solver.solve(times, 3, previous, survivors, 1, true);
+    bool passed = tight.status == "optimal" && tight.makespan == 3 && tight.jobs_moved == 2 &&
+                  tight.resolve_jobs_moved == 4 && tight.split_points == std::vector<int>{0, 2, 5, 8} &&
+                  slack.status == "optimal" && slack.optimal_makespan == 3 && slack.makespan == 4 &&
+                  slack.jobs_moved == 1 && slack.split_points == std::vector<int>{0, 1, 5, 8};
+    if (!passed) {
+        std::cout << "✗ FAIL: Stable re-optimization moved " << tight.jobs_moved << " and "
+                  << slack.jobs_moved << " jobs, expected 2 and 1" << std::endl;
+    } else {
+        std::cout << "✓ PASS: Stable re-optimization moved 2 jobs at T* and 1 at T* + 1"
+                  << " (plain re-solve: " << tight.resolve_jobs_moved << ")" << std::endl;
+    }
+    std::cout << std::string(70, '=') << std::endl;
+    return passed;
+}
+
 // Run a single test case
 bool run_test_case(const TestCase& tc) {
     std::cout << "\n" << std::string(70, '=') << std::endl;
@@ -72,23 +331,20 @@ bool run_test_case(const TestCase& tc) {
         PseudoPolySolution pseudo_sol = pseudo_solver.solve(tc.times, tc.m, true);
         
         if (pseudo_sol.isValid()) {
-            // Convert partition to assignments
-            std::map<int, std::vector<int>> pseudo_assignments;
-            for (size_t i = 0; i < pseudo_sol.partition.size(); i++) {
-                pseudo_assignments[i] = pseudo_sol.partition[i];
-            }
-            
             print_solution("Pseudo-polynomial", 
                           pseudo_sol.makespan,
                           pseudo_sol.solve_time,
                           tc.times,
-                          pseudo_assignments);
+                          pseudo_sol.split_points);
             
             pseudo_makespan = pseudo_sol.makespan;
             
             // Check against expected value
             double diff = std::abs(pseudo_sol.makespan - tc.expected_makespan);
-            if (diff == 0.0) {
+            if (!valid_split_points(pseudo_sol.split_points, static_cast<int>(tc.times.size()), tc.m)) {
+                std::cout << "✗ FAIL: Malformed split points" << std::endl;
+                test_passed = false;
+            } else if (diff == 0.0) {
                 std::cout << "✓ PASS: Makespan matches expected value" << std::endl;
             } else {
                 std::cout << "✗ FAIL: Makespan differs from expected value" << std::endl;
@@ -106,6 +362,43 @@ bool run_test_case(const TestCase& tc) {
         test_passed = false;
     }
     
+    // Worker threads from the first job on: the split input scans, the parallel
+    // prefix scan and one threshold per worker give the sequential split points
+    PseudoPolyOptions parallel_options;
+    parallel_options.threads = 4;
+    parallel_options.parallel_min_jobs = 1;
+    PseudoPolySolution sequential = PseudoPolynomialSolver().solve(tc.times, tc.m, true);
+    bool parallel_ok = true;
+    for (int lanes : {1, 4}) {
+        parallel_options.probe_lanes = lanes;
+        PseudoPolySolution parallel = PseudoPolynomialSolver(parallel_options).solve(tc.times, tc.m, true);
+        parallel_ok &= parallel.status == "optimal" && parallel.makespan == sequential.makespan &&
+                       parallel.split_points == sequential.split_points;
+    }
+    std::vector<int> broken = tc.times;
+    broken[broken.size() / 2] = 0;
+    std::string sequential_error;
+    std::string parallel_error;
+    parallel_ok &= !validateInput(broken, tc.m, sequential_error, true) &&
+                   !validateInput(broken, tc.m, parallel_error, true, 4) &&
+                   parallel_error == sequential_error;
+    if (!parallel_ok) {
+        std::cout << "✗ FAIL: 4 worker threads disagree with the sequential solve" << std::endl;
+        test_passed = false;
+    } else {
+        std::cout << "✓ PASS: 4 worker threads match the sequential split points" << std::endl;
+    }
+
+    // No machines, or a negative count, is rejected with a status
+    PseudoPolynomialSolver rejecting_solver;
+    if (rejecting_solver.solve(tc.times, 0, true).status != "invalid_input" ||
+        rejecting_solver.solve(tc.times, -1, true).status != "invalid_input") {
+        std::cout << "✗ FAIL: m < 1 not rejected" << std::endl;
+        test_passed = false;
+    } else {
+        std::cout << "✓ PASS: m < 1 rejected as invalid input" << std::endl;
+    }
+
     // ============================================
     // 2. MILP SOLUTION (TEST MODE)
     // ============================================
@@ -120,7 +413,7 @@ bool run_test_case(const TestCase& tc) {
                               milp_sol.makespan,
                               milp_sol.solve_time,
                               tc.times,
-                              milp_sol.assignments);
+                              milp_sol.split_points);
                 
                 milp_makespan = milp_sol.makespan;
                 
@@ -160,6 +453,418 @@ bool run_test_case(const TestCase& tc) {
         std::cout << "\n2. MILP SOLUTION: Skipped (n=" << tc.times.size() << " > 200)" << std::endl;
     }
     
+    // ============================================
+    // 3. ALTERNATIVE ENGINES
+    // ============================================
+    std::cout << "\n3. ALTERNATIVE ENGINES" << std::endl;
+    try {
+        LinearPartitionSolver linear_solver;
+        test_passed &= check_engine("Linear-time", linear_solver.solve(tc.times, tc.m, true), tc);
+        
+        DPSolver dp_solver;
+        test_passed &= check_engine("DP", dp_solver.solve(tc.times, tc.m, true), tc);
+        
+        // Dynamic instance: built from scratch, then after an edit and its undo
+        DynamicInstance dynamic(tc.times, tc.m);
+        test_passed &= check_engine("Dynamic", dynamic.toSolution(), tc);
+        dynamic.insertJob(0, 24);
+        dynamic.eraseJob(0);
+        test_passed &= check_engine("Dynamic (edit + undo)", dynamic.toSolution(), tc);
+        
+        // Allocation-free path: one solver and one result, reused after a larger instance
+        PseudoPolynomialSolver reused_solver;
+        PseudoPolySolution reused;
+        std::vector<int> doubled(tc.times);
+        doubled.insert(doubled.end(), tc.times.begin(), tc.times.end());
+        reused_solver.solve(doubled, tc.m, reused, true);
+        reused_solver.solve(tc.times, tc.m, reused, true);
+        test_passed &= check_engine("Reused workspace", reused, tc);
+        
+        // Capacity curve at m and the inverse query for the expected makespan
+        PseudoPolynomialSolver capacity_solver;
+        CapacityProfile profile = capacity_solver.capacityProfile(
+            tc.times, tc.m, static_cast<int>(tc.expected_makespan));
+        if (profile.makespan_by_machines.back() != tc.expected_makespan ||
+            profile.min_machines < 1 || profile.min_machines > tc.m ||
+            profile.makespan_by_machines[profile.min_machines - 1] > tc.expected_makespan) {
+            std::cout << "✗ FAIL: Capacity profile disagrees with expected makespan" << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Capacity profile T*(m) = " << profile.makespan_by_machines.back()
+                      << ", min machines " << profile.min_machines << std::endl;
+        }
+        
+        // Uniform speeds reproduce the identical-machine optimum, scaled to
+        // wall-clock time; machines may stay idle, so blocks can be empty
+        HeterogeneousPartitionSolver heterogeneous_solver;
+        for (double speed : {1.0, 2.0}) {
+            PseudoPolySolution uniform = heterogeneous_solver.solve(
+                tc.times, std::vector<double>(tc.m, speed), true);
+            bool blocks_ok = uniform.split_points.size() == static_cast<size_t>(tc.m) + 1 &&
+                             uniform.split_points.front() == 0 &&
+                             uniform.split_points.back() == static_cast<int>(tc.times.size()) &&
+                             std::is_sorted(uniform.split_points.begin(), uniform.split_points.end());
+            if (uniform.status != "optimal" || !blocks_ok ||
+                uniform.makespan * speed != tc.expected_makespan) {
+                std::cout << "✗ FAIL: Heterogeneous (speed " << speed << ") makespan "
+                          << uniform.makespan << std::endl;
+                test_passed = false;
+            } else {
+                std::cout << "✓ PASS: Heterogeneous (speed " << speed << ") makespan "
+                          << uniform.makespan << " (" << uniform.feasibility_checks
+                          << " checks)" << std::endl;
+            }
+        }
+        
+        // Mixed speeds: blocks snap to rational (load, units) candidates over
+        // different gcd-reduced units, and very slow machines may stay idle
+        for (const std::vector<double>& pattern : {std::vector<double>{1.0, 1.5, 0.5},
+                                                   std::vector<double>{2.5, 0.1, 1.0}}) {
+            std::vector<double> speeds(tc.m);
+            for (int j = 0; j < tc.m; j++) speeds[j] = pattern[j % pattern.size()];
+            PseudoPolySolution mixed = heterogeneous_solver.solve(tc.times, speeds, true);
+            double expected = brute_force_speeds(tc.times, speeds);
+            bool blocks_ok = mixed.split_points.size() == static_cast<size_t>(tc.m) + 1 &&
+                             mixed.split_points.front() == 0 &&
+                             mixed.split_points.back() == static_cast<int>(tc.times.size()) &&
+                             std::is_sorted(mixed.split_points.begin(), mixed.split_points.end());
+            double largest = 0.0;
+            int idle = 0;
+            for (int j = 0; blocks_ok && j < tc.m; j++) {
+                largest = std::max(largest, mixed.machine_loads[j] / speeds[j]);
+                idle += mixed.split_points[j] == mixed.split_points[j + 1];
+            }
+            if (mixed.status != "optimal" || !blocks_ok ||
+                std::abs(mixed.makespan - expected) > 1e-9 * expected ||
+                std::abs(largest - expected) > 1e-9 * expected) {
+                std::cout << "✗ FAIL: Heterogeneous (speeds " << pattern[0] << ", " << pattern[1]
+                          << ", " << pattern[2] << ") makespan " << mixed.makespan << ", expected "
+                          << expected << std::endl;
+                test_passed = false;
+            } else {
+                std::cout << "✓ PASS: Heterogeneous (speeds " << pattern[0] << ", " << pattern[1]
+                          << ", " << pattern[2] << ") makespan " << mixed.makespan << ", "
+                          << idle << " idle machines" << std::endl;
+            }
+        }
+        
+        // Pipeline: free transfers give the plain optimum; unit transfers match
+        // the exhaustive DP exactly
+        PipelinePartitionSolver pipeline_solver;
+        PseudoPolySolution free_transfers = pipeline_solver.solve(
+            tc.times, std::vector<int>(tc.times.size() - 1, 0), tc.m, true);
+        test_passed &= check_engine("Pipeline (free transfers)", free_transfers, tc);
+        PseudoPolySolution unit_transfers = pipeline_solver.solve(
+            tc.times, std::vector<int>(tc.times.size() - 1, 1), tc.m, true);
+        if (unit_transfers.status != "optimal" ||
+            !valid_split_points(unit_transfers.split_points, static_cast<int>(tc.times.size()), tc.m) ||
+            unit_transfers.makespan != brute_force_pipeline(
+                tc.times, std::vector<int>(tc.times.size() - 1, 1), tc.m)) {
+            std::cout << "✗ FAIL: Pipeline (unit transfers) makespan " << unit_transfers.makespan
+                      << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Pipeline (unit transfers) makespan " << unit_transfers.makespan
+                      << std::endl;
+        }
+        
+        // Ring: the best rotation found by solving every rotation linearly
+        long long best_rotation = tc.expected_makespan;
+        std::vector<int> rotated = tc.times;
+        PseudoPolynomialSolver rotation_solver;
+        for (size_t r = 1; r < tc.times.size(); r++) {
+            std::rotate(rotated.begin(), rotated.begin() + 1, rotated.end());
+            PseudoPolySolution linear = rotation_solver.solve(rotated, tc.m, true);
+            best_rotation = std::min(best_rotation, static_cast<long long>(linear.makespan));
+        }
+        CircularPartitionSolver circular_solver;
+        PseudoPolySolution ring = circular_solver.solve(tc.times, tc.m, true);
+        bool arcs_ok = ring.split_points.size() >= 2 &&
+                       ring.split_points.size() <= static_cast<size_t>(tc.m) + 1 &&
+                       ring.split_points.back() - ring.split_points.front() ==
+                           static_cast<int>(tc.times.size()) &&
+                       !ring.machine_loads.empty() &&
+                       *std::max_element(ring.machine_loads.begin(), ring.machine_loads.end()) ==
+                           best_rotation;
+        if (ring.status != "optimal" || !arcs_ok || ring.makespan != best_rotation) {
+            std::cout << "✗ FAIL: Circular makespan " << ring.makespan << " (best rotation "
+                      << best_rotation << ")" << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Circular makespan " << ring.makespan << " from job "
+                      << ring.split_points.front() << std::endl;
+        }
+        
+        // Nodes then cores: without transfers any grouping of the flat optimum is
+        // optimal; unit transfers add at most two to the bottleneck core
+        HierarchicalPartitionSolver hierarchical_solver;
+        for (long long cost : {0LL, 1LL}) {
+            HierarchicalSolution nested = hierarchical_solver.solve(tc.times, tc.m, 1, cost, true);
+            bool nested_ok = nested.status == "optimal" &&
+                             nested.node_split_points.size() == static_cast<size_t>(tc.m) + 1 &&
+                             nested.core_split_points.size() == static_cast<size_t>(tc.m) &&
+                             nested.node_split_points.back() == static_cast<int>(tc.times.size());
+            bool makespan_ok = cost == 0 ? nested.makespan == tc.expected_makespan
+                                         : nested.makespan >= tc.expected_makespan &&
+                                               nested.makespan <= tc.expected_makespan + 2;
+            if (!nested_ok || !makespan_ok) {
+                std::cout << "✗ FAIL: Hierarchical (transfer " << cost << ") makespan "
+                          << nested.makespan << std::endl;
+                test_passed = false;
+            } else {
+                std::cout << "✓ PASS: Hierarchical (transfer " << cost << ") makespan "
+                          << nested.makespan << std::endl;
+            }
+        }
+        
+        // Several cores per node: the in/out transfers on the first and last core,
+        // the last node refilled without an outgoing transfer and, once a transfer
+        // costs as much as T*, idle nodes padded at the end, against the exact DP
+        for (int cores : {2, 3}) {
+            int nodes = tc.m / cores;
+            if (nodes < 1) continue;
+            for (long long cost : {1LL, 3LL, static_cast<long long>(tc.expected_makespan)}) {
+                HierarchicalSolution nested = hierarchical_solver.solve(tc.times, nodes, cores, cost, true);
+                long long expected = brute_force_nested(tc.times, nodes, cores, cost);
+                bool nested_ok = nested.status == "optimal" &&
+                                 nested.node_split_points.size() == static_cast<size_t>(nodes) + 1 &&
+                                 nested.core_split_points.size() == static_cast<size_t>(nodes) &&
+                                 nested.node_split_points.back() == static_cast<int>(tc.times.size());
+                long long largest = 0;
+                for (int node = 0; nested_ok && node < nodes; node++) {
+                    const std::vector<int>& splits = nested.core_split_points[node];
+                    nested_ok = splits.size() == static_cast<size_t>(cores) + 1 &&
+                                splits.front() == nested.node_split_points[node] &&
+                                splits.back() == nested.node_split_points[node + 1] &&
+                                std::is_sorted(splits.begin(), splits.end());
+                    for (long long load : nested.core_loads[node]) largest = std::max(largest, load);
+                }
+                if (!nested_ok || nested.makespan != expected || largest != expected) {
+                    std::cout << "✗ FAIL: Hierarchical (" << nodes << " x " << cores << ", transfer "
+                              << cost << ") makespan " << nested.makespan << ", expected "
+                              << expected << std::endl;
+                    test_passed = false;
+                } else {
+                    std::cout << "✓ PASS: Hierarchical (" << nodes << " x " << cores << ", transfer "
+                              << cost << ") makespan " << nested.makespan << std::endl;
+                }
+            }
+        }
+        
+        // Vector loads: the times alone, and the times next to a copy of themselves
+        // at twice the capacity, both reproduce the single-resource optimum
+        MultiResourcePartitionSolver multi_resource_solver;
+        for (int dimensions : {1, 2}) {
+            std::vector<std::vector<int>> resources(dimensions, tc.times);
+            std::vector<long long> capacities = {1, 2};
+            capacities.resize(dimensions);
+            MultiResourceSolution vector_load = multi_resource_solver.solve(
+                resources, tc.m, capacities, true);
+            if (vector_load.status != "optimal" ||
+                !valid_split_points(vector_load.split_points, static_cast<int>(tc.times.size()), tc.m) ||
+                vector_load.makespan != tc.expected_makespan || vector_load.bottleneck_resource != 0) {
+                std::cout << "✗ FAIL: Multi-resource (d = " << dimensions << ") makespan "
+                          << vector_load.makespan << std::endl;
+                test_passed = false;
+            } else {
+                std::cout << "✓ PASS: Multi-resource (d = " << dimensions << ") makespan "
+                          << vector_load.makespan << std::endl;
+            }
+        }
+        
+        // Five resources: one full AVX2 compare plus a masked one-lane tail. The
+        // last resource, 3 t + 1 over capacity 3, scores above every other one on
+        // every block, so it sets the fractional makespan
+        const int n = static_cast<int>(tc.times.size());
+        long long total = 0;
+        for (int t : tc.times) total += t;
+        std::vector<std::vector<int>> five(5, std::vector<int>(n));
+        for (int j = 0; j < n; j++) {
+            five[0][j] = tc.times[j];
+            five[1][j] = 0;
+            five[2][j] = tc.times[n - 1 - j];
+            five[3][j] = 1;
+            five[4][j] = 3 * tc.times[j] + 1;
+        }
+        std::vector<long long> five_capacities = {2, 1, 2 * total, n, 3};
+        MultiResourceSolution five_loads = multi_resource_solver.solve(five, tc.m, five_capacities, true);
+        double five_expected = brute_force_resources(five, tc.m, five_capacities);
+        if (five_loads.status != "optimal" ||
+            !valid_split_points(five_loads.split_points, n, tc.m) ||
+            std::abs(five_loads.makespan - five_expected) > 1e-9 * five_expected ||
+            five_loads.bottleneck_resource != 4) {
+            std::cout << "✗ FAIL: Multi-resource (d = 5) makespan " << five_loads.makespan
+                      << " on resource " << five_loads.bottleneck_resource << ", expected "
+                      << five_expected << " on resource 4" << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Multi-resource (d = 5) makespan " << five_loads.makespan
+                      << " on resource " << five_loads.bottleneck_resource << std::endl;
+        }
+        
+        // Slack: growing a job by its slack keeps T*, one more unit raises it
+        SensitivityAnalyzer sensitivity_analyzer;
+        SensitivityReport sensitivity = sensitivity_analyzer.analyze(tc.times, tc.m, true);
+        bool slack_ok = sensitivity.status == "optimal" &&
+                        sensitivity.makespan == static_cast<long long>(tc.expected_makespan) &&
+                        sensitivity.critical_jobs > 0;
+        PseudoPolynomialSolver what_if_solver;
+        for (size_t i = 0; slack_ok && i < tc.times.size(); i++) {
+            std::vector<int> slower = tc.times;
+            slower[i] += static_cast<int>(sensitivity.slack[i]);
+            slack_ok &= what_if_solver.solve(slower, tc.m, true).makespan == tc.expected_makespan;
+            slower[i] += 1;
+            slack_ok &= what_if_solver.solve(slower, tc.m, true).makespan > tc.expected_makespan;
+        }
+        if (!slack_ok) {
+            std::cout << "✗ FAIL: Sensitivity slack disagrees with what-if solves" << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Sensitivity slack, " << sensitivity.critical_jobs
+                      << " critical jobs" << std::endl;
+        }
+        
+        // Certificate: the witness proves T* - 1 infeasible, and the verifier
+        // rejects the same witness once the partition is worse than T*
+        PseudoPolyOptions certified_options;
+        certified_options.certificate = true;
+        PseudoPolynomialSolver certified_solver(certified_options);
+        PseudoPolySolution certified = certified_solver.solve(tc.times, tc.m, true);
+        CertificateCheck certificate = PartitionVerifier::verify(
+            tc.times, tc.m, certified.split_points, certified.witness);
+        CertificateCheck one_block = PartitionVerifier::verify(
+            tc.times, tc.m, {0, static_cast<int>(tc.times.size())}, certified.witness);
+        bool one_block_optimal = one_block.makespan == static_cast<long long>(tc.expected_makespan);
+        if (!certificate.optimal() || certificate.makespan != tc.expected_makespan ||
+            one_block.optimal() != one_block_optimal) {
+            std::cout << "✗ FAIL: Certificate " << (certificate.optimal() ? "accepted" : "rejected")
+                      << " " << certificate.message << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Certificate verified for makespan " << certificate.makespan
+                      << std::endl;
+        }
+        
+        // Stable re-optimization: unchanged conditions move nothing, and after
+        // losing the first machine, at T* and at T* + 1, the moved count matches
+        // the fewest possible from an exhaustive DP and its split points
+        std::vector<int> previous = certified.split_points;
+        previous.resize(tc.m + 1, static_cast<int>(tc.times.size()));
+        StablePartitionSolver stable_solver;
+        PseudoPolynomialSolver stable_resolver;
+        StableRepartition unchanged = stable_solver.solve(tc.times, tc.m, previous, {}, 0, true);
+        bool stable_ok = unchanged.status == "optimal" && unchanged.jobs_moved == 0 &&
+                         unchanged.makespan == static_cast<long long>(tc.expected_makespan);
+        long long moved_after_loss = 0;
+        if (stable_ok && tc.m > 1) {
+            std::vector<int> survivors;
+            for (int k = 1; k < tc.m; k++) survivors.push_back(k);
+            long long resolved = static_cast<long long>(stable_resolver.solve(tc.times, tc.m - 1, true).makespan);
+            for (long long slack : {0LL, 1LL}) {
+                StableRepartition lost = stable_solver.solve(tc.times, tc.m - 1, previous, survivors, slack, true);
+                long long fewest = brute_force_moved(tc.times, previous, survivors, resolved + slack);
+                stable_ok &= lost.status == "optimal" &&
+                             static_cast<int>(lost.split_points.size()) == tc.m &&
+                             std::is_sorted(lost.split_points.begin(), lost.split_points.end()) &&
+                             lost.optimal_makespan == resolved && lost.makespan <= resolved + slack &&
+                             lost.jobs_moved == fewest && lost.jobs_moved <= lost.resolve_jobs_moved &&
+                             lost.jobs_moved == static_cast<long long>(tc.times.size()) -
+                                                    kept_jobs(lost.split_points, previous, survivors);
+                if (slack == 0) moved_after_loss = lost.jobs_moved;
+            }
+        }
+        if (!stable_ok) {
+            std::cout << "✗ FAIL: Stable re-optimization" << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Stable re-optimization, " << moved_after_loss
+                      << " jobs moved after losing machine 0" << std::endl;
+        }
+
+        // Coarsening: pairs of jobs merged down to a few super-jobs; with no fine
+        // probes the error bound brackets T*, with unlimited ones it closes
+        CoarseningOptions coarse_options;
+        coarse_options.group_size = 2;
+        coarse_options.coarse_jobs = 4;
+        coarse_options.max_fine_probes = 0;
+        CoarseSolution rough = CoarsePartitionSolver(coarse_options).solve(tc.times, tc.m, true);
+        coarse_options.max_fine_probes = -1;
+        CoarseSolution refined = CoarsePartitionSolver(coarse_options).solve(tc.times, tc.m, true);
+        if (rough.lower_bound > tc.expected_makespan || rough.makespan < tc.expected_makespan ||
+            rough.error_bound > rough.max_super_job ||
+            !valid_split_points(rough.split_points, static_cast<int>(tc.times.size()), tc.m) ||
+            refined.status != "optimal" || refined.makespan != tc.expected_makespan) {
+            std::cout << "✗ FAIL: Coarsening makespan " << rough.makespan << " (bound "
+                      << rough.error_bound << "), refined " << refined.makespan << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Coarsening over " << rough.levels << " levels within "
+                      << rough.error_bound << ", refined in " << refined.fine_checks
+                      << " fine checks" << std::endl;
+        }
+
+        // Streaming engine over the same times written to a temporary file
+        std::FILE* stream = std::tmpfile();
+        for (int t : tc.times) std::fprintf(stream, "%d\n", t);
+        std::rewind(stream);
+        StreamingSolver streaming_solver(64);  // Small chunks to cross chunk borders
+        StreamingSolution streamed = streaming_solver.solve(stream, tc.m);
+        std::fclose(stream);
+        if (streamed.status != "optimal" || streamed.makespan != tc.expected_makespan ||
+            streamed.split_points.back() != static_cast<long long>(tc.times.size())) {
+            std::cout << "✗ FAIL: Streaming status " << streamed.status << ", makespan "
+                      << streamed.makespan << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Streaming makespan " << streamed.makespan
+                      << " (" << streamed.passes << " passes)" << std::endl;
+        }
+        
+        // Free job order can only help; the job assignment must reproduce the loads
+        HighMultiplicitySolver free_order_solver;
+        HighMultiplicitySolution free_order = free_order_solver.solve(tc.times, tc.m, true);
+        std::vector<long long> assigned(tc.m, 0);
+        for (size_t job = 0; free_order.isValid() && job < tc.times.size(); job++) {
+            assigned[free_order.job_machine[job]] += tc.times[job];
+        }
+        if (free_order.status != "optimal" || free_order.makespan > tc.expected_makespan ||
+            free_order.makespan < free_order.lower_bound || assigned != free_order.machine_loads) {
+            std::cout << "✗ FAIL: Free-order status " << free_order.status << ", makespan "
+                      << free_order.makespan << std::endl;
+            test_passed = false;
+        } else {
+            std::cout << "✓ PASS: Free-order makespan " << free_order.makespan
+                      << " (lower bound " << free_order.lower_bound << ", "
+                      << free_order.nodes << " nodes)" << std::endl;
+        }
+        
+        // Heuristics: a permutation of the jobs, never below the free-order optimum
+        for (FreeOrderHeuristic heuristic : {FreeOrderHeuristic::LPT, FreeOrderHeuristic::Multifit,
+                                             FreeOrderHeuristic::KarmarkarKarp}) {
+            std::string name = FreeOrderHeuristicSolver::name(heuristic);
+            PseudoPolySolution schedule = FreeOrderHeuristicSolver(heuristic).solve(tc.times, tc.m, true);
+            std::vector<int> order(schedule.job_order);
+            std::sort(order.begin(), order.end());
+            bool permutation = order.size() == tc.times.size();
+            for (size_t i = 0; permutation && i < order.size(); i++) {
+                permutation = order[i] == static_cast<int>(i);
+            }
+            if (!permutation ||
+                !valid_split_points(schedule.split_points, static_cast<int>(tc.times.size()), tc.m) ||
+                schedule.makespan < free_order.makespan || schedule.gap < 0.0) {
+                std::cout << "✗ FAIL: " << name << " status " << schedule.status << ", makespan "
+                          << schedule.makespan << std::endl;
+                test_passed = false;
+            } else {
+                std::cout << "✓ PASS: " << name << " makespan " << schedule.makespan
+                          << " (gap " << schedule.gap * 100 << "%)" << std::endl;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cout << "Engine Exception: " << e.what() << std::endl;
+        test_passed = false;
+    }
+    
     std::cout << std::string(70, '=') << std::endl;
     return test_passed;
 }
@@ -187,12 +892,21 @@ int main() {
         }
     }
     
+    // Hand-checked examples outside the validation cases
+    for (bool example_passed : {run_pipeline_example(), run_stable_example()}) {
+        if (example_passed) {
+            passed++;
+        } else {
+            failed++;
+        }
+    }
+    
     // Summary
     std::cout << "\n" << std::string(70, '=') << std::endl;
     std::cout << "TEST SUMMARY" << std::endl;
     std::cout << std::string(70, '=') << std::endl;
     
-    std::cout << "Total tests: " << test_cases.size() << std::endl;
+    std::cout << "Total tests: " << passed + failed << std::endl;
     std::cout << "Passed:      " << passed << std::endl;
     std::cout << "Failed:      " << failed << std::endl;
     